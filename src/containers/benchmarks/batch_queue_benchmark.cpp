@@ -0,0 +1,80 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+#include "../queue/s21_batch_queue.h"
+
+// Пропускная способность BatchQueue: поштучные push/pop (мьютекс на каждое
+// сообщение) против push_bulk/pop_bulk пачками разного размера.
+
+using Clock = std::chrono::steady_clock;
+
+void run(int threads, int per_producer, std::size_t batch) {
+  s21::BatchQueue<long long> queue(4096);
+  const long long total = 1LL * threads * per_producer;
+  std::vector<long long> sums(threads, 0);
+
+  auto start = Clock::now();
+  std::vector<std::thread> producers;
+  std::vector<std::thread> consumers;
+  for (int p = 0; p < threads; ++p) {
+    producers.emplace_back([&queue, per_producer, batch] {
+      if (batch == 1) {
+        for (int i = 0; i < per_producer; ++i) queue.push(i);
+        return;
+      }
+      std::vector<long long> items;
+      items.reserve(batch);
+      for (int i = 0; i < per_producer; ++i) {
+        items.push_back(i);
+        if (items.size() == batch) {
+          queue.push_bulk(items);
+          items.clear();
+        }
+      }
+      queue.push_bulk(items);
+    });
+    consumers.emplace_back([&queue, &sums, p, batch] {
+      long long local = 0;
+      if (batch == 1) {
+        long long value;
+        while (queue.pop(value)) local += value;
+      } else {
+        std::vector<long long> buffer(batch);
+        while (std::size_t n = queue.pop_bulk(buffer.begin(), batch)) {
+          for (std::size_t i = 0; i < n; ++i) local += buffer[i];
+        }
+      }
+      sums[p] = local;
+    });
+  }
+  for (auto& producer : producers) producer.join();
+  queue.close();
+  for (auto& consumer : consumers) consumer.join();
+  double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+  long long sum = 0;
+  for (long long part : sums) sum += part;
+  std::printf("%2d x %2d threads, batch %4zu: %.2f Mops/s (%lld)\n", threads,
+              threads, batch, total / seconds / 1e6, sum);
+}
+
+int main(int argc, char** argv) {
+  int per_producer = argc > 1 ? std::atoi(argv[1]) : 1000000;
+  int cores = static_cast<int>(std::thread::hardware_concurrency());
+  if (cores < 1) cores = 1;
+  std::vector<int> counts;
+  for (int threads = 1; threads < cores; threads *= 2) {
+    counts.push_back(threads);
+  }
+  counts.push_back(cores);
+  for (int threads : counts) {
+    for (std::size_t batch : {1, 16, 256}) {
+      run(threads, per_producer / threads, batch);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,75 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <random>
+#include <vector>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+#include "../map/s21_btree_map.h"
+#include "../map/s21_map.h"
+
+// Индекс int -> int: вставка n ключей в случайном порядке, затем at() по
+// случайным ключам. Память — прирост занятой кучи (только на glibc).
+
+using Clock = std::chrono::steady_clock;
+
+// Занятая в куче память по данным glibc, включая служебные заголовки malloc
+std::size_t heap_bytes() {
+#ifdef __GLIBC__
+  return mallinfo2().uordblks;
+#else
+  return 0;
+#endif
+}
+
+template <typename MapType>
+void run(const char* name, const std::vector<int>& keys,
+         const std::vector<int>& probes) {
+  const std::size_t before = heap_bytes();
+  auto start = Clock::now();
+  {
+    MapType map;
+    for (int key : keys) map.insert(std::make_pair(key, key));
+    double insert_ns =
+        std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    const std::size_t bytes = heap_bytes() - before;
+
+    long long sum = 0;
+    start = Clock::now();
+    for (int key : probes) sum += map.at(key);
+    double lookup_ns =
+        std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+    std::printf(
+        "%-16s insert %6.1f ns/op, at() %6.1f ns/op, %5.1f bytes/entry "
+        "(%lld)\n",
+        name, insert_ns / keys.size(), lookup_ns / probes.size(),
+        static_cast<double>(bytes) / keys.size(), sum);
+  }
+}
+
+int main(int argc, char** argv) {
+  int n = argc > 1 ? std::atoi(argv[1]) : 2000000;
+  std::mt19937 gen(1);
+  std::vector<int> keys(n);
+  for (int i = 0; i < n; ++i) keys[i] = i;
+  std::vector<int> sorted = keys;
+  std::shuffle(keys.begin(), keys.end(), gen);
+  std::vector<int> probes(keys);
+  std::shuffle(probes.begin(), probes.end(), gen);
+
+  std::printf("random order, n=%d\n", n);
+  run<s21::Map<int, int>>("s21::Map", keys, probes);
+  run<std::map<int, int>>("std::map", keys, probes);
+  run<s21::BTreeMap<int, int>>("s21::BTreeMap", keys, probes);
+  run<s21::BTreeMap<int, int, 256>>("BTreeMap<256>", keys, probes);
+  run<s21::BTreeMap<int, int, 1024>>("BTreeMap<1024>", keys, probes);
+  std::printf("ascending order, n=%d\n", n);
+  run<s21::Map<int, int>>("s21::Map", sorted, probes);
+  run<s21::BTreeMap<int, int>>("s21::BTreeMap", sorted, probes);
+  return 0;
+}
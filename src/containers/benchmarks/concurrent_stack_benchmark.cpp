@@ -0,0 +1,74 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../stack/s21_concurrent_stack.h"
+#include "../stack/s21_stack.h"
+
+// Кэш свободных объектов: каждый поток снимает элемент со стека и кладёт
+// его обратно. ConcurrentStack против s21::Stack под мьютексом при числе
+// потоков от 1 до 64.
+
+using Clock = std::chrono::steady_clock;
+
+class MutexStack {
+ public:
+  void push(long long value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stack_.push(value);
+  }
+
+  bool try_pop(long long& out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stack_.empty()) return false;
+    out = stack_.top();
+    stack_.pop();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::Stack<long long> stack_;
+};
+
+template <typename StackType>
+void run(const char* name, int threads, int total_ops) {
+  StackType stack;
+  for (int i = 0; i < 1024; ++i) stack.push(i);
+  const int per_thread = total_ops / threads;
+  std::vector<long long> sums(threads, 0);
+
+  auto start = Clock::now();
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([&stack, &sums, t, per_thread] {
+      long long value = 0;
+      long long local = 0;
+      for (int i = 0; i < per_thread; ++i) {
+        if (stack.try_pop(value)) local += value;
+        stack.push(value);
+      }
+      sums[t] = local;
+    });
+  }
+  for (auto& worker : workers) worker.join();
+  double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+  long long sum = 0;
+  for (long long part : sums) sum += part;
+  std::printf("%-20s %2d threads: %.2f Mops/s (%lld)\n", name, threads,
+              2.0 * per_thread * threads / seconds / 1e6, sum % 1000);
+}
+
+int main(int argc, char** argv) {
+  int total_ops = argc > 1 ? std::atoi(argv[1]) : 4000000;
+  for (int threads = 1; threads <= 64; threads *= 2) {
+    run<MutexStack>("mutex + s21::Stack", threads, total_ops);
+    run<s21::ConcurrentStack<long long>>("s21::ConcurrentStack", threads,
+                                         total_ops);
+  }
+  return 0;
+}
@@ -0,0 +1,76 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "../map/s21_hash_map.h"
+#include "../map/s21_map.h"
+
+// Индекс int -> int размером от 1K до n ключей (n — аргумент, по умолчанию
+// 1M; 100M требует около 10 ГБ памяти под s21::Map). Вставка в случайном
+// порядке, затем at() по существующим ключам и contains() по отсутствующим.
+
+using Clock = std::chrono::steady_clock;
+
+double elapsed_ns(Clock::time_point start) {
+  return std::chrono::duration<double, std::nano>(Clock::now() - start)
+      .count();
+}
+
+// contains() появился в std::unordered_map только в C++20
+template <typename MapType>
+bool has(MapType& map, int key) {
+  return map.contains(key);
+}
+
+bool has(std::unordered_map<int, int>& map, int key) {
+  return map.count(key) != 0;
+}
+
+template <typename MapType>
+void run(const char* name, const std::vector<int>& keys,
+         const std::vector<int>& probes) {
+  const int n = static_cast<int>(keys.size());
+  auto start = Clock::now();
+  MapType map;
+  for (int key : keys) map.insert(std::make_pair(key, key));
+  double insert_ns = elapsed_ns(start);
+
+  long long sum = 0;
+  start = Clock::now();
+  for (int key : probes) sum += map.at(key);
+  double hit_ns = elapsed_ns(start);
+
+  // Ключи не меньше n в словаре отсутствуют
+  start = Clock::now();
+  for (int key : probes) sum += has(map, key + n);
+  double miss_ns = elapsed_ns(start);
+
+  std::printf("%-20s insert %6.1f ns/op, at() %6.1f ns/op, "
+              "miss %6.1f ns/op (%lld)\n",
+              name, insert_ns / keys.size(), hit_ns / probes.size(),
+              miss_ns / probes.size(), sum);
+}
+
+int main(int argc, char** argv) {
+  int max_n = argc > 1 ? std::atoi(argv[1]) : 1000000;
+  std::mt19937 gen(1);
+  for (int n = 1000; n <= max_n; n *= 10) {
+    std::vector<int> keys(n);
+    for (int i = 0; i < n; ++i) keys[i] = i;
+    std::shuffle(keys.begin(), keys.end(), gen);
+    // Не меньше 1M обращений, чтобы маленькие таблицы мерились стабильно
+    std::vector<int> probes(std::max(n, 1000000));
+    for (std::size_t i = 0; i < probes.size(); ++i) probes[i] = keys[i % n];
+    std::shuffle(probes.begin(), probes.end(), gen);
+
+    std::printf("n=%d\n", n);
+    run<s21::Map<int, int>>("s21::Map", keys, probes);
+    run<std::unordered_map<int, int>>("std::unordered_map", keys, probes);
+    run<s21::HashMap<int, int>>("s21::HashMap", keys, probes);
+  }
+  return 0;
+}
@@ -0,0 +1,77 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "../multiset/s21_hash_multiset.h"
+#include "../multiset/s21_multiset.h"
+#include "../set/s21_hash_set.h"
+#include "../set/s21_set.h"
+
+// Упорядоченные s21::Set и s21::Multiset против хешированных аналогов.
+// Множество: n различных ключей в случайном порядке, затем contains() по
+// существующим и отсутствующим ключам. Мультимножество: n ключей из n / 8
+// различных значений (в среднем восемь копий), затем count().
+
+using Clock = std::chrono::steady_clock;
+
+double elapsed_ns(Clock::time_point start) {
+  return std::chrono::duration<double, std::nano>(Clock::now() - start)
+      .count();
+}
+
+template <typename SetType>
+void run_set(const char* name, const std::vector<int>& keys) {
+  const int n = static_cast<int>(keys.size());
+  auto start = Clock::now();
+  SetType set;
+  for (int key : keys) set.insert(key);
+  double insert_ns = elapsed_ns(start);
+
+  long long hits = 0;
+  start = Clock::now();
+  // Половина ключей есть в множестве, половина — нет
+  for (int key : keys) hits += set.contains(key + (key & 1) * n);
+  double lookup_ns = elapsed_ns(start);
+
+  std::printf("%-20s insert %6.1f ns/op, contains() %6.1f ns/op (%lld)\n",
+              name, insert_ns / n, lookup_ns / n, hits);
+}
+
+template <typename SetType>
+void run_multiset(const char* name, const std::vector<int>& keys) {
+  const std::size_t n = keys.size();
+  auto start = Clock::now();
+  SetType set;
+  for (int key : keys) set.insert(key);
+  double insert_ns = elapsed_ns(start);
+
+  long long total = 0;
+  start = Clock::now();
+  for (int key : keys) total += static_cast<long long>(set.count(key));
+  double count_ns = elapsed_ns(start);
+
+  std::printf("%-20s insert %6.1f ns/op, count() %6.1f ns/op (%lld)\n", name,
+              insert_ns / n, count_ns / n, total);
+}
+
+int main(int argc, char** argv) {
+  int n = argc > 1 ? std::atoi(argv[1]) : 1000000;
+  std::mt19937 gen(1);
+  std::vector<int> keys(n);
+  for (int i = 0; i < n; ++i) keys[i] = i;
+  std::shuffle(keys.begin(), keys.end(), gen);
+
+  std::printf("set, n=%d\n", n);
+  run_set<s21::Set<int>>("s21::Set", keys);
+  run_set<s21::HashSet<int>>("s21::HashSet", keys);
+
+  std::uniform_int_distribution<int> value(0, std::max(n / 8, 1) - 1);
+  for (int& key : keys) key = value(gen);
+  std::printf("multiset, n=%d, %d distinct\n", n, std::max(n / 8, 1));
+  run_multiset<s21::Multiset<int>>("s21::Multiset", keys);
+  run_multiset<s21::HashMultiset<int>>("s21::HashMultiset", keys);
+  return 0;
+}
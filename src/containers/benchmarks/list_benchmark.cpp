@@ -0,0 +1,56 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <list>
+
+#include "../list/s21_list.h"
+
+// Очередь сообщений на списке: push_back/pop_front с окном в window
+// элементов, стек push_back/pop_back на почти пустом списке, плюс
+// заполнение и clear() большого списка.
+
+using Clock = std::chrono::steady_clock;
+
+template <typename ListType>
+void run(const char* name, int n, int window) {
+  ListType list;
+  long long sum = 0;
+  auto start = Clock::now();
+  for (int i = 0; i < n; ++i) {
+    list.push_back(i);
+    if (static_cast<int>(list.size()) > window) {
+      sum += list.front();
+      list.pop_front();
+    }
+  }
+  double queue_s = std::chrono::duration<double>(Clock::now() - start).count();
+
+  start = Clock::now();
+  for (int i = 0; i < n; ++i) {
+    list.push_back(i);
+    sum += list.back();
+    list.pop_back();
+  }
+  double stack_s = std::chrono::duration<double>(Clock::now() - start).count();
+
+  start = Clock::now();
+  ListType big;
+  for (int i = 0; i < n; ++i) big.push_back(i);
+  big.clear();
+  double fill_s = std::chrono::duration<double>(Clock::now() - start).count();
+
+  std::printf(
+      "%-10s window=%-6d queue %.1f, stack %.1f, fill+clear %.1f Mops/s "
+      "(%lld)\n",
+      name, window, n / queue_s / 1e6, n / stack_s / 1e6, n / fill_s / 1e6,
+      sum);
+}
+
+int main(int argc, char** argv) {
+  int n = argc > 1 ? std::atoi(argv[1]) : 10000000;
+  for (int window : {1, 16, 100000}) {
+    run<std::list<int>>("std::list", n, window);
+    run<s21::List<int>>("s21::List", n, window);
+  }
+  return 0;
+}
@@ -0,0 +1,40 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+
+#include "../map/s21_map.h"
+
+// Худший случай для несбалансированного дерева: ключи приходят по
+// возрастанию. Сравниваем латентность at() с std::map.
+
+using Clock = std::chrono::steady_clock;
+
+template <typename MapType>
+void run(const char* name, int n) {
+  MapType map;
+  auto start = Clock::now();
+  for (int i = 0; i < n; ++i) {
+    map.insert(std::make_pair(i, i));
+  }
+  double insert_ns =
+      std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+  long long sum = 0;
+  start = Clock::now();
+  for (int i = 0; i < n; ++i) {
+    sum += map.at(i);
+  }
+  double lookup_ns =
+      std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+  std::printf("%-10s n=%d insert %.1f ns/op, at() %.1f ns/op (checksum %lld)\n",
+              name, n, insert_ns / n, lookup_ns / n, sum);
+}
+
+int main(int argc, char** argv) {
+  int n = argc > 1 ? std::atoi(argv[1]) : 1000000;
+  run<s21::Map<int, int>>("s21::Map", n);
+  run<std::map<int, int>>("std::map", n);
+  return 0;
+}
@@ -0,0 +1,92 @@
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../queue/s21_mpmc_queue.h"
+#include "../queue/s21_queue.h"
+
+// Пропускная способность MpmcQueue при k производителях и k потребителях,
+// k от 1 до числа ядер, против s21::Queue под одним мьютексом.
+
+using Clock = std::chrono::steady_clock;
+
+class MutexQueue {
+ public:
+  explicit MutexQueue(std::size_t capacity) : capacity_(capacity) {}
+
+  bool try_push(long long value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.size() >= capacity_) return false;
+    queue_.push(value);
+    return true;
+  }
+
+  bool try_pop(long long& out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.empty()) return false;
+    out = queue_.front();
+    queue_.pop();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::Queue<long long> queue_;
+  std::size_t capacity_;
+};
+
+template <typename QueueType>
+void run(const char* name, int threads, int per_producer) {
+  QueueType queue(1024);
+  const long long total = 1LL * threads * per_producer;
+  std::atomic<long long> consumed{0};
+  std::atomic<long long> sum{0};
+
+  auto start = Clock::now();
+  std::vector<std::thread> workers;
+  for (int p = 0; p < threads; ++p) {
+    workers.emplace_back([&] {
+      for (int i = 0; i < per_producer; ++i) {
+        while (!queue.try_push(i)) std::this_thread::yield();
+      }
+    });
+    workers.emplace_back([&] {
+      long long value;
+      long long local = 0;
+      while (consumed.load(std::memory_order_relaxed) < total) {
+        if (queue.try_pop(value)) {
+          local += value;
+          consumed.fetch_add(1, std::memory_order_relaxed);
+        } else {
+          std::this_thread::yield();
+        }
+      }
+      sum.fetch_add(local);
+    });
+  }
+  for (auto& worker : workers) worker.join();
+  double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+  std::printf("%-20s %2d producers x %2d consumers: %.2f Mops/s (%lld)\n",
+              name, threads, threads, total / seconds / 1e6, sum.load());
+}
+
+int main(int argc, char** argv) {
+  int per_producer = argc > 1 ? std::atoi(argv[1]) : 1000000;
+  int cores = static_cast<int>(std::thread::hardware_concurrency());
+  if (cores < 1) cores = 1;
+  std::vector<int> counts;
+  for (int threads = 1; threads < cores; threads *= 2) {
+    counts.push_back(threads);
+  }
+  counts.push_back(cores);
+  for (int threads : counts) {
+    run<MutexQueue>("mutex + s21::Queue", threads, per_producer / threads);
+    run<s21::MpmcQueue<long long>>("s21::MpmcQueue", threads,
+                                   per_producer / threads);
+  }
+  return 0;
+}
@@ -0,0 +1,94 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <queue>
+#include <random>
+#include <vector>
+
+#include "../list/s21_list.h"
+#include "../queue/s21_priority_queue.h"
+
+// Модель «hold» планировщика событий: очередь держит size событий, каждая
+// операция снимает ближайшее и кладёт новое со временем top + случайная
+// задержка. Сравниваются отсортированный
+// s21::List со вставкой линейным поиском, d-арные кучи и
+// std::priority_queue. Отдельно — построение кучи из диапазона за O(n)
+// против n вставок.
+
+using Clock = std::chrono::steady_clock;
+
+class SortedList {
+ public:
+  void push(long long value) {
+    auto it = list_.cbegin();
+    while (it != list_.cend() && *it <= value) ++it;
+    list_.insert(it, value);
+  }
+  long long top() const { return list_.front(); }
+  void pop() { list_.pop_front(); }
+
+ private:
+  s21::List<long long> list_;
+};
+
+template <typename QueueType>
+void hold(const char* name, int size, int ops) {
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<long long> delay(0, 1 << 20);
+  QueueType queue;
+  for (int i = 0; i < size; ++i) queue.push(delay(gen));
+
+  long long sum = 0;
+  auto start = Clock::now();
+  for (int i = 0; i < ops; ++i) {
+    long long now = queue.top();
+    sum += now;
+    queue.pop();
+    queue.push(now + delay(gen));
+  }
+  double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+  std::printf("%-22s size=%-6d %8.2f Mops/s (%lld)\n", name, size,
+              ops / seconds / 1e6, sum % 1000);
+}
+
+void build(int n) {
+  std::mt19937 gen(7);
+  std::uniform_int_distribution<int> value(0, 1 << 30);
+  std::vector<int> items(n);
+  for (int& item : items) item = value(gen);
+
+  auto start = Clock::now();
+  s21::PriorityQueue<int> heapified(items.begin(), items.end());
+  double heapify_s =
+      std::chrono::duration<double>(Clock::now() - start).count();
+
+  start = Clock::now();
+  s21::PriorityQueue<int> pushed;
+  for (int item : items) pushed.push(item);
+  double push_s = std::chrono::duration<double>(Clock::now() - start).count();
+
+  std::printf("build n=%d: heapify %.1f ms, n x push %.1f ms (%d %d)\n", n,
+              heapify_s * 1e3, push_s * 1e3, heapified.top(), pushed.top());
+}
+
+template <std::size_t Arity>
+using Heap = s21::PriorityQueue<long long, s21::Vector<long long>,
+                                std::greater<long long>, Arity>;
+using StdHeap = std::priority_queue<long long, std::vector<long long>,
+                                    std::greater<long long>>;
+
+int main(int argc, char** argv) {
+  int ops = argc > 1 ? std::atoi(argv[1]) : 1000000;
+  for (int size : {100, 1000, 10000, 100000}) {
+    if (size <= 10000) {
+      hold<SortedList>("sorted s21::List", size, ops / (size / 100));
+    }
+    hold<Heap<2>>("s21::PriorityQueue d=2", size, ops);
+    hold<Heap<4>>("s21::PriorityQueue d=4", size, ops);
+    hold<Heap<8>>("s21::PriorityQueue d=8", size, ops);
+    hold<StdHeap>("std::priority_queue", size, ops);
+  }
+  build(ops);
+  return 0;
+}
@@ -0,0 +1,55 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <queue>
+
+#include "../list/s21_list.h"
+#include "../queue/s21_queue.h"
+
+// Пропускная способность очереди: push/pop с окном в window элементов
+// для int и для 64-байтного сообщения, на разных контейнерах.
+
+struct Message {
+  long long words[8];
+
+  Message(int value = 0) { words[0] = value; }
+};
+
+long long value_of(int value) { return value; }
+long long value_of(const Message& message) { return message.words[0]; }
+
+using Clock = std::chrono::steady_clock;
+
+template <typename QueueType>
+void run(const char* name, int n, int window) {
+  QueueType queue;
+  long long sum = 0;
+  auto start = Clock::now();
+  for (int i = 0; i < n; ++i) {
+    queue.push(typename QueueType::value_type(i));
+    if (static_cast<int>(queue.size()) > window) {
+      sum += value_of(queue.front());
+      queue.pop();
+    }
+  }
+  double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+  std::printf("%-28s window=%-6d %.1f Mops/s (%lld)\n", name, window,
+              n / seconds / 1e6, sum);
+}
+
+template <typename T>
+void run_all(const char* type, int n) {
+  std::printf("%s:\n", type);
+  for (int window : {16, 100000}) {
+    run<std::queue<T>>("std::queue (deque)", n, window);
+    run<s21::Queue<T, s21::List<T>>>("s21::Queue<List>", n, window);
+    run<s21::Queue<T>>("s21::Queue<RingBuffer>", n, window);
+  }
+}
+
+int main(int argc, char** argv) {
+  int n = argc > 1 ? std::atoi(argv[1]) : 10000000;
+  run_all<int>("int", n);
+  run_all<Message>("64-byte message", n);
+  return 0;
+}
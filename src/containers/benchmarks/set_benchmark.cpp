@@ -0,0 +1,78 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <numeric>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "../set/s21_set.h"
+
+// Скорость find()/contains() на множествах разного размера.
+// Ключи вставляются в случайном порядке, половина запросов — промахи.
+// Для сравнения те же запросы выполняются на std::set.
+
+using Clock = std::chrono::steady_clock;
+
+// std::set::contains появляется только в C++20.
+template <typename Key>
+bool contains(s21::Set<Key>& set, const Key& key) {
+  return set.contains(key);
+}
+
+template <typename Key>
+bool contains(const std::set<Key>& set, const Key& key) {
+  return set.count(key) != 0;
+}
+
+template <typename SetType>
+void run(const char* name, int n, int lookups) {
+  std::vector<int> keys(n);
+  std::iota(keys.begin(), keys.end(), 0);
+  std::mt19937 gen(42);
+  std::shuffle(keys.begin(), keys.end(), gen);
+
+  SetType set;
+  for (int key : keys) {
+    set.insert(key * 2);
+  }
+
+  std::uniform_int_distribution<int> dist(0, 2 * n - 1);
+  std::vector<int> queries(lookups);
+  for (int& q : queries) q = dist(gen);
+
+  long long hits = 0;
+  auto start = Clock::now();
+  for (int q : queries) {
+    hits += contains(set, q);
+  }
+  double contains_s =
+      std::chrono::duration<double>(Clock::now() - start).count();
+
+  start = Clock::now();
+  for (int q : queries) {
+    hits += set.find(q) != set.end();
+  }
+  double find_s = std::chrono::duration<double>(Clock::now() - start).count();
+
+  std::printf(
+      "%-9s n=%-9d contains %.0f lookups/s, find %.0f lookups/s "
+      "(hits %lld of %d)\n",
+      name, n, lookups / contains_s, lookups / find_s, hits, 2 * lookups);
+}
+
+void run_all(int n, int lookups) {
+  run<s21::Set<int>>("s21::Set", n, lookups);
+  run<std::set<int>>("std::set", n, lookups);
+}
+
+int main(int argc, char** argv) {
+  int lookups = 1000000;
+  if (argc > 1) {
+    for (int i = 1; i < argc; ++i) run_all(std::atoi(argv[i]), lookups);
+  } else {
+    for (int n : {10000, 1000000, 10000000}) run_all(n, lookups);
+  }
+  return 0;
+}
@@ -0,0 +1,94 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../queue/s21_queue.h"
+#include "../queue/s21_spsc_queue.h"
+
+// Передача элементов из одного потока в другой: SpscQueue против
+// s21::Queue под мьютексом. Каждый элемент несёт время отправки,
+// потребитель считает задержку передачи; выводятся ops/s и p99.
+
+using Clock = std::chrono::steady_clock;
+
+struct Item {
+  long long sent_ns;
+};
+
+long long now_ns() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             Clock::now().time_since_epoch())
+      .count();
+}
+
+class MutexQueue {
+ public:
+  bool try_push(const Item& item) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.size() >= capacity_) return false;
+    queue_.push(item);
+    return true;
+  }
+
+  bool try_pop(Item& out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.empty()) return false;
+    out = queue_.front();
+    queue_.pop();
+    return true;
+  }
+
+  explicit MutexQueue(std::size_t capacity) : capacity_(capacity) {}
+
+ private:
+  std::mutex mutex_;
+  s21::Queue<Item> queue_;
+  std::size_t capacity_;
+};
+
+template <typename QueueType>
+void run(const char* name, int n, std::size_t capacity) {
+  QueueType queue(capacity);
+  std::vector<long long> latencies;
+  latencies.reserve(n);
+
+  auto start = Clock::now();
+  std::thread producer([&] {
+    for (int i = 0; i < n; ++i) {
+      Item item{now_ns()};
+      while (!queue.try_push(item)) std::this_thread::yield();
+    }
+  });
+  Item item;
+  for (int received = 0; received < n;) {
+    if (!queue.try_pop(item)) {
+      std::this_thread::yield();
+      continue;
+    }
+    latencies.push_back(now_ns() - item.sent_ns);
+    ++received;
+  }
+  producer.join();
+  double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+  std::nth_element(latencies.begin(), latencies.begin() + n * 99 / 100,
+                   latencies.end());
+  long long p99 = latencies[n * 99 / 100];
+  std::nth_element(latencies.begin(), latencies.begin() + n / 2,
+                   latencies.end());
+  std::printf("%-22s capacity=%-6zu %.1f Mops/s, p50 %lld ns, p99 %lld ns\n",
+              name, capacity, n / seconds / 1e6, latencies[n / 2], p99);
+}
+
+int main(int argc, char** argv) {
+  int n = argc > 1 ? std::atoi(argv[1]) : 2000000;
+  for (std::size_t capacity : {64, 4096}) {
+    run<MutexQueue>("mutex + s21::Queue", n, capacity);
+    run<s21::SpscQueue<Item>>("s21::SpscQueue", n, capacity);
+  }
+  return 0;
+}
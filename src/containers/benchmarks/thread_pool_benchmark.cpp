@@ -0,0 +1,86 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include "../deque/s21_thread_pool.h"
+#include "../vector/s21_vector.h"
+
+// Масштабирование ThreadPool с кражей задач по числу рабочих: рекурсивный
+// fib с порогом последовательного счёта и сумма s21::Vector делением
+// диапазона пополам. Ускорение считается от последовательной версии.
+
+using Clock = std::chrono::steady_clock;
+
+long long fib_serial(int n) {
+  return n < 2 ? n : fib_serial(n - 1) + fib_serial(n - 2);
+}
+
+long long fib(s21::ThreadPool& pool, int n) {
+  if (n < 20) return fib_serial(n);
+  long long left = 0;
+  s21::TaskGroup group(pool);
+  group.run([&] { left = fib(pool, n - 1); });
+  long long right = fib(pool, n - 2);
+  group.wait();
+  return left + right;
+}
+
+long long sum(s21::ThreadPool& pool, const long long* first,
+              const long long* last) {
+  if (last - first <= 1 << 16) {
+    long long total = 0;
+    for (; first != last; ++first) total += *first;
+    return total;
+  }
+  const long long* middle = first + (last - first) / 2;
+  long long left = 0;
+  s21::TaskGroup group(pool);
+  group.run([&] { left = sum(pool, first, middle); });
+  long long right = sum(pool, middle, last);
+  group.wait();
+  return left + right;
+}
+
+template <typename F>
+double seconds_of(F&& f) {
+  auto start = Clock::now();
+  f();
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+int main(int argc, char** argv) {
+  int n = argc > 1 ? std::atoi(argv[1]) : 38;
+  int length = argc > 2 ? std::atoi(argv[2]) : 1 << 25;
+  s21::Vector<long long> values(length);
+  for (int i = 0; i < length; ++i) values[i] = i % 1000;
+
+  long long result = 0;
+  double fib_serial_s = seconds_of([&] { result = fib_serial(n); });
+  double sum_serial_s = seconds_of([&] {
+    for (int i = 0; i < length; ++i) result += values[i];
+  });
+  std::printf("serial: fib(%d) %.1f ms, sum %.1f ms (%lld)\n", n,
+              fib_serial_s * 1e3, sum_serial_s * 1e3, result);
+
+  int cores = static_cast<int>(std::thread::hardware_concurrency());
+  if (cores < 1) cores = 1;
+  std::vector<int> counts;
+  for (int threads = 1; threads < cores; threads *= 2) {
+    counts.push_back(threads);
+  }
+  counts.push_back(cores);
+  for (int threads : counts) {
+    s21::ThreadPool pool(threads);
+    double fib_s = seconds_of([&] { result = fib(pool, n); });
+    double sum_s = seconds_of([&] {
+      result += sum(pool, values.data(), values.data() + length);
+    });
+    std::printf(
+        "%2d workers: fib %.1f ms (x%.2f), sum %.1f ms (x%.2f) (%lld)\n",
+        threads, fib_s * 1e3, fib_serial_s / fib_s, sum_s * 1e3,
+        sum_serial_s / sum_s, result);
+  }
+  return 0;
+}
@@ -0,0 +1,50 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#include "../list/s21_list.h"
+#include "../list/s21_unrolled_list.h"
+
+// Полные проходы по списку int: сумма через итераторы, reverse() и
+// unique() на значениях с повторами, и оценка памяти на элемент.
+
+using Clock = std::chrono::steady_clock;
+
+template <typename ListType>
+void run(const char* name, int n, double bytes_per_item) {
+  ListType list;
+  for (int i = 0; i < n; ++i) list.push_back(i / 4);
+
+  auto start = Clock::now();
+  long long sum = 0;
+  for (int pass = 0; pass < 10; ++pass) {
+    for (auto it = list.begin(); it != list.end(); ++it) sum += *it;
+  }
+  double scan_s = std::chrono::duration<double>(Clock::now() - start).count();
+
+  start = Clock::now();
+  for (int pass = 0; pass < 10; ++pass) list.reverse();
+  double reverse_s =
+      std::chrono::duration<double>(Clock::now() - start).count();
+
+  start = Clock::now();
+  list.unique();
+  double unique_s = std::chrono::duration<double>(Clock::now() - start).count();
+
+  std::printf(
+      "%-14s n=%-9d scan %.2f ns/item, reverse %.2f ns/item, unique %.2f "
+      "ns/item, ~%.1f bytes/item (%lld, %zu)\n",
+      name, n, scan_s * 1e9 / (10.0 * n), reverse_s * 1e9 / (10.0 * n),
+      unique_s * 1e9 / n, bytes_per_item, sum, list.size());
+}
+
+int main(int argc, char** argv) {
+  int n = argc > 1 ? std::atoi(argv[1]) : 4000000;
+  using Unrolled = s21::UnrolledList<int>;
+  const double chunk = sizeof(Unrolled::Chunk);
+  const double per_chunk = 256 / sizeof(int);
+  run<s21::List<int>>("s21::List", n, sizeof(s21::List<int>::Node));
+  // Блоки заполнены наполовину после делений и полностью при push_back
+  run<Unrolled>("UnrolledList", n, chunk / per_chunk);
+  return 0;
+}
@@ -0,0 +1,96 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "../vector/s21_vector.h"
+
+// Тяжёлый элемент на 4 КБ, считающий вызовы своих конструкторов.
+struct Payload {
+  char bytes[4096];
+
+  Payload() {
+    ++defaults;
+    bytes[0] = 0;
+  }
+  Payload(const Payload& other) {
+    ++copies;
+    std::copy(other.bytes, other.bytes + sizeof(bytes), bytes);
+  }
+  Payload& operator=(const Payload& other) {
+    ++assigns;
+    std::copy(other.bytes, other.bytes + sizeof(bytes), bytes);
+    return *this;
+  }
+
+  static long defaults;
+  static long copies;
+  static long assigns;
+
+  static void reset() { defaults = copies = assigns = 0; }
+};
+
+long Payload::defaults = 0;
+long Payload::copies = 0;
+long Payload::assigns = 0;
+
+using Clock = std::chrono::steady_clock;
+
+template <typename VectorType>
+void run(const char* name, int n) {
+  Payload item;
+  Payload::reset();
+  auto start = Clock::now();
+  {
+    VectorType vector;
+    for (int i = 0; i < n; ++i) {
+      vector.push_back(item);
+    }
+  }
+  double ms =
+      std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+  std::printf(
+      "%-12s n=%d push_back %.1f ms: default ctors %ld, copy ctors %ld, "
+      "copy assigns %ld\n",
+      name, n, ms, Payload::defaults, Payload::copies, Payload::assigns);
+}
+
+// Рост буфера тривиально копируемых элементов.
+template <typename VectorType>
+void run_trivial(const char* name, long n) {
+  auto start = Clock::now();
+  VectorType vector;
+  for (long i = 0; i < n; ++i) {
+    vector.push_back(i);
+  }
+  double ms =
+      std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+  std::printf("%-12s n=%ld long push_back %.1f ms\n", name, n, ms);
+}
+
+// Средний неиспользуемый запас ёмкости для векторов случайных размеров.
+template <typename Policy>
+void run_slack(const char* name) {
+  double slack = 0;
+  const int runs = 1000;
+  for (int i = 1; i <= runs; ++i) {
+    s21::Vector<int, Policy> vector;
+    int n = i * 97 % 100000 + 1;
+    for (int j = 0; j < n; ++j) vector.push_back(j);
+    slack += double(vector.capacity() - vector.size()) / vector.capacity();
+  }
+  std::printf("%-18s average slack %.1f%%\n", name, 100 * slack / runs);
+}
+
+int main(int argc, char** argv) {
+  int n = argc > 1 ? std::atoi(argv[1]) : 100000;
+  run<s21::Vector<Payload>>("s21::Vector", n);
+  run<std::vector<Payload>>("std::vector", n);
+  run_trivial<s21::Vector<long>>("s21::Vector", 100L * n);
+  run_trivial<std::vector<long>>("std::vector", 100L * n);
+  run_slack<s21::DoubleGrowth>("DoubleGrowth");
+  run_slack<s21::HalfGrowth>("HalfGrowth");
+  run_slack<s21::SizeClassGrowth>("SizeClassGrowth");
+  run_slack<s21::FixedGrowth<4096>>("FixedGrowth<4096>");
+  return 0;
+}
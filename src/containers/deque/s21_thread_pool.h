@@ -0,0 +1,233 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../queue/s21_batch_queue.h"
+#include "s21_work_stealing_deque.h"
+
+namespace s21 {
+// Пул потоков с кражей задач. У каждого рабочего свой WorkStealingDeque:
+// задачи, порождённые внутри рабочего, кладутся в его дек и исполняются
+// в порядке LIFO, а простаивающие рабочие крадут старые задачи у других.
+// Задачи из внешних потоков идут в общую очередь. Рабочий без работы
+// засыпает на условной переменной; таймаут страхует от потерянного
+// пробуждения. Деструктор дожидается выполнения всех поставленных задач.
+class ThreadPool {
+ public:  // members
+  using size_type = std::size_t;
+  using task_type = std::function<void()>;
+
+ public:  // constructors
+  explicit ThreadPool(size_type threads = std::thread::hardware_concurrency());
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+  ~ThreadPool();
+
+ public:  // tasks
+  template <typename F>
+  void submit(F&& task);
+  // Выполняет одну ожидающую задачу в вызывающем потоке
+  bool run_one();
+  size_type size() const noexcept;
+
+ private:  // workers
+  struct Worker {
+    explicit Worker(std::uint32_t s) : seed(s) {}
+
+    WorkStealingDeque<task_type*> deque;
+    std::uint32_t seed;  // состояние xorshift для выбора жертвы
+  };
+
+  // Рабочий, которым является текущий поток, если он из этого пула
+  struct Current {
+    ThreadPool* pool = nullptr;
+    size_type index = 0;
+  };
+  static Current& current() noexcept {
+    static thread_local Current current;
+    return current;
+  }
+
+ private:  // attributes
+  std::vector<std::unique_ptr<Worker>> workers_;
+  std::vector<std::thread> threads_;
+  BatchQueue<task_type*> injected_;
+  std::mutex sleep_mutex_;
+  std::condition_variable wake_;
+  std::atomic<size_type> sleeping_{0};
+  std::atomic<bool> stop_{false};
+
+ private:  // helpers
+  void enqueue(task_type* task);
+  task_type* find_task();
+  task_type* steal_task(size_type thief);
+  void worker_loop(size_type index);
+  static void run_task(task_type* task);
+};
+
+// Группа задач для fork/join: wait() ждёт завершения всех задач группы,
+// а пока ждёт — сама исполняет задачи пула. Первое исключение из задачи
+// перебрасывается из wait().
+class TaskGroup {
+ public:  // constructors
+  explicit TaskGroup(ThreadPool& pool) : pool_(pool) {}
+  TaskGroup(const TaskGroup&) = delete;
+  TaskGroup& operator=(const TaskGroup&) = delete;
+  ~TaskGroup();
+
+ public:  // tasks
+  template <typename F>
+  void run(F&& task);
+  void wait();
+
+ private:  // attributes
+  ThreadPool& pool_;
+  std::atomic<std::size_t> pending_{0};
+  std::mutex error_mutex_;
+  std::exception_ptr error_;
+};
+
+inline ThreadPool::ThreadPool(size_type threads) {
+  if (threads == 0) threads = 1;
+  for (size_type i = 0; i < threads; ++i) {
+    workers_.push_back(std::make_unique<Worker>(
+        static_cast<std::uint32_t>(i * 2654435761u + 1)));
+  }
+  for (size_type i = 0; i < threads; ++i) {
+    threads_.emplace_back([this, i] { worker_loop(i); });
+  }
+}
+
+inline ThreadPool::~ThreadPool() {
+  stop_.store(true, std::memory_order_release);
+  {
+    std::lock_guard<std::mutex> lock(sleep_mutex_);
+  }
+  wake_.notify_all();
+  for (auto& thread : threads_) thread.join();
+}
+
+template <typename F>
+void ThreadPool::submit(F&& task) {
+  enqueue(new task_type(std::forward<F>(task)));
+}
+
+inline bool ThreadPool::run_one() {
+  task_type* task = find_task();
+  if (!task) return false;
+  run_task(task);
+  return true;
+}
+
+inline ThreadPool::size_type ThreadPool::size() const noexcept {
+  return workers_.size();
+}
+
+inline void ThreadPool::enqueue(task_type* task) {
+  const Current& self = current();
+  if (self.pool == this) {
+    workers_[self.index]->deque.push(task);
+  } else {
+    injected_.push(task);
+  }
+  if (sleeping_.load(std::memory_order_acquire) > 0) wake_.notify_one();
+}
+
+inline ThreadPool::task_type* ThreadPool::find_task() {
+  const Current& self = current();
+  task_type* task = nullptr;
+  if (self.pool == this && workers_[self.index]->deque.pop(task)) return task;
+  if (injected_.try_pop(task)) return task;
+  return steal_task(self.pool == this ? self.index : workers_.size());
+}
+
+inline ThreadPool::task_type* ThreadPool::steal_task(size_type thief) {
+  // Жертвы перебираются со случайного места, чтобы воры не толпились
+  const size_type n = workers_.size();
+  size_type start = 0;
+  if (thief < n) {
+    std::uint32_t& seed = workers_[thief]->seed;
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    start = seed % n;
+  }
+  task_type* task = nullptr;
+  for (size_type i = 0; i < n; ++i) {
+    const size_type victim = (start + i) % n;
+    if (victim != thief && workers_[victim]->deque.steal(task)) return task;
+  }
+  return nullptr;
+}
+
+inline void ThreadPool::worker_loop(size_type index) {
+  current() = Current{this, index};
+  int idle = 0;
+  for (;;) {
+    if (task_type* task = find_task()) {
+      run_task(task);
+      idle = 0;
+      continue;
+    }
+    if (stop_.load(std::memory_order_acquire)) break;
+    if (++idle < 64) {
+      std::this_thread::yield();
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(sleep_mutex_);
+    sleeping_.fetch_add(1, std::memory_order_acq_rel);
+    wake_.wait_for(lock, std::chrono::milliseconds(1));
+    sleeping_.fetch_sub(1, std::memory_order_acq_rel);
+  }
+  current() = Current{};
+}
+
+inline void ThreadPool::run_task(task_type* task) {
+  std::unique_ptr<task_type> owner(task);
+  (*owner)();
+}
+
+inline TaskGroup::~TaskGroup() {
+  // Задачи ссылаются на группу, поэтому разрушать её раньше нельзя
+  while (pending_.load(std::memory_order_acquire) > 0) {
+    if (!pool_.run_one()) std::this_thread::yield();
+  }
+}
+
+template <typename F>
+void TaskGroup::run(F&& task) {
+  pending_.fetch_add(1, std::memory_order_relaxed);
+  pool_.submit([this, task = std::forward<F>(task)]() mutable {
+    try {
+      task();
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(error_mutex_);
+      if (!error_) error_ = std::current_exception();
+    }
+    pending_.fetch_sub(1, std::memory_order_release);
+  });
+}
+
+inline void TaskGroup::wait() {
+  while (pending_.load(std::memory_order_acquire) > 0) {
+    if (!pool_.run_one()) std::this_thread::yield();
+  }
+  std::exception_ptr error;
+  {
+    std::lock_guard<std::mutex> lock(error_mutex_);
+    std::swap(error, error_);
+  }
+  if (error) std::rethrow_exception(error);
+}
+}  // namespace s21
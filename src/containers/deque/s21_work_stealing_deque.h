@@ -0,0 +1,179 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace s21 {
+// Дек Чейза — Лева для планировщика с кражей задач. Владелец работает
+// с нижним концом как со стеком (push/pop, LIFO), остальные потоки крадут
+// с верхнего конца (steal, FIFO) без блокировок. Буфер кольцевой; при
+// заполнении владелец копирует элементы в буфер вдвое больше, а старый
+// хранит до разрушения дека, потому что вор мог успеть его прочитать.
+// Слоты — std::atomic<T>, поэтому T должен копироваться побайтово;
+// обычно это указатель на задачу.
+template <typename T>
+class WorkStealingDeque {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "WorkStealingDeque stores trivially copyable values");
+
+ public:  // members
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = std::size_t;
+
+  static constexpr size_type kCacheLine = 64;
+
+ public:  // constructors
+  explicit WorkStealingDeque(size_type capacity = 64);
+  WorkStealingDeque(const WorkStealingDeque&) = delete;
+  WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+  ~WorkStealingDeque() = default;
+
+ public:  // owner
+  void push(const_reference value);
+  bool pop(reference out);
+
+ public:  // thieves
+  bool steal(reference out);
+
+ public:  // capacity
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type capacity() const noexcept;
+
+ private:  // buffer
+  class Buffer {
+   public:
+    explicit Buffer(size_type capacity)
+        : mask_(capacity - 1), slots_(new std::atomic<T>[capacity]) {}
+
+    size_type capacity() const noexcept { return mask_ + 1; }
+    T get(std::int64_t i) const noexcept {
+      return slots_[i & mask_].load(std::memory_order_relaxed);
+    }
+    void put(std::int64_t i, T value) noexcept {
+      slots_[i & mask_].store(value, std::memory_order_relaxed);
+    }
+
+   private:
+    const size_type mask_;
+    std::unique_ptr<std::atomic<T>[]> slots_;
+  };
+
+ private:  // attributes
+  alignas(kCacheLine) std::atomic<std::int64_t> top_{0};
+  alignas(kCacheLine) std::atomic<std::int64_t> bottom_{0};
+  std::atomic<Buffer*> buffer_;
+  // Все буферы, включая текущий; меняет только владелец
+  std::vector<std::unique_ptr<Buffer>> buffers_;
+
+ private:  // helpers
+  Buffer* grow(Buffer* old, std::int64_t top, std::int64_t bottom);
+  static size_type round_capacity(size_type capacity);
+};
+
+template <typename T>
+WorkStealingDeque<T>::WorkStealingDeque(size_type capacity) {
+  buffers_.push_back(std::make_unique<Buffer>(round_capacity(capacity)));
+  buffer_.store(buffers_.back().get(), std::memory_order_relaxed);
+}
+
+template <typename T>
+void WorkStealingDeque<T>::push(const_reference value) {
+  const std::int64_t bottom = bottom_.load(std::memory_order_relaxed);
+  const std::int64_t top = top_.load(std::memory_order_acquire);
+  Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+  if (bottom - top >= static_cast<std::int64_t>(buffer->capacity())) {
+    buffer = grow(buffer, top, bottom);
+  }
+  buffer->put(bottom, value);
+  // Вор, увидевший новый bottom_, увидит и записанный слот
+  bottom_.store(bottom + 1, std::memory_order_release);
+}
+
+template <typename T>
+bool WorkStealingDeque<T>::pop(reference out) {
+  const std::int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+  Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+  // Уменьшение bottom_ и чтение top_ упорядочены полностью: иначе владелец
+  // и вор могут одновременно забрать последний элемент
+  bottom_.store(bottom, std::memory_order_seq_cst);
+  std::int64_t top = top_.load(std::memory_order_seq_cst);
+  if (top > bottom) {
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+    return false;
+  }
+  out = buffer->get(bottom);
+  if (top == bottom) {
+    // Последний элемент разыгрывается с ворами через top_
+    const bool won = top_.compare_exchange_strong(
+        top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+    return won;
+  }
+  return true;
+}
+
+template <typename T>
+bool WorkStealingDeque<T>::steal(reference out) {
+  std::int64_t top = top_.load(std::memory_order_seq_cst);
+  const std::int64_t bottom = bottom_.load(std::memory_order_seq_cst);
+  if (top >= bottom) return false;
+  Buffer* buffer = buffer_.load(std::memory_order_acquire);
+  const T value = buffer->get(top);
+  if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                    std::memory_order_relaxed)) {
+    return false;  // элемент забрал владелец или другой вор
+  }
+  out = value;
+  return true;
+}
+
+template <typename T>
+bool WorkStealingDeque<T>::empty() const noexcept {
+  return size() == 0;
+}
+
+template <typename T>
+typename WorkStealingDeque<T>::size_type WorkStealingDeque<T>::size()
+    const noexcept {
+  // Снимок при одновременных операциях приблизителен
+  const std::int64_t bottom = bottom_.load(std::memory_order_acquire);
+  const std::int64_t top = top_.load(std::memory_order_acquire);
+  return bottom > top ? static_cast<size_type>(bottom - top) : 0;
+}
+
+template <typename T>
+typename WorkStealingDeque<T>::size_type WorkStealingDeque<T>::capacity()
+    const noexcept {
+  return buffer_.load(std::memory_order_acquire)->capacity();
+}
+
+template <typename T>
+typename WorkStealingDeque<T>::Buffer* WorkStealingDeque<T>::grow(
+    Buffer* old, std::int64_t top, std::int64_t bottom) {
+  auto bigger = std::make_unique<Buffer>(old->capacity() * 2);
+  for (std::int64_t i = top; i < bottom; ++i) bigger->put(i, old->get(i));
+  Buffer* raw = bigger.get();
+  buffers_.push_back(std::move(bigger));
+  buffer_.store(raw, std::memory_order_release);
+  return raw;
+}
+
+template <typename T>
+typename WorkStealingDeque<T>::size_type WorkStealingDeque<T>::round_capacity(
+    size_type capacity) {
+  if (capacity == 0) {
+    throw std::invalid_argument("WorkStealingDeque capacity must be positive");
+  }
+  size_type rounded = 1;
+  while (rounded < capacity) rounded *= 2;
+  return rounded;
+}
+}  // namespace s21
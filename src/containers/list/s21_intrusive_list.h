@@ -0,0 +1,439 @@
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <utility>
+
+namespace s21 {
+// Связи элемента интрузивного списка. Объект, который должен состоять в
+// нескольких списках сразу, держит по одному крюку на каждый список.
+class IntrusiveListHook {
+  template <typename T, IntrusiveListHook T::*Hook>
+  friend class IntrusiveList;
+
+ public:
+  IntrusiveListHook() = default;
+  // Копия объекта не наследует членство в списках оригинала
+  IntrusiveListHook(const IntrusiveListHook &) noexcept {}
+  IntrusiveListHook &operator=(const IntrusiveListHook &) noexcept {
+    return *this;
+  }
+  ~IntrusiveListHook() = default;
+
+  bool is_linked() const noexcept { return next_ != nullptr; }
+
+ private:
+  IntrusiveListHook *next_ = nullptr;
+  IntrusiveListHook *prev_ = nullptr;
+};
+
+// Интрузивный список: связи хранятся в самом объекте (член Hook), поэтому
+// вставка и удаление ничего не выделяют и не копируют. Список не владеет
+// элементами: clear() и деструктор только отцепляют их.
+template <typename T, IntrusiveListHook T::*Hook>
+class IntrusiveList {
+ public:  // internal classes
+  class IntrusiveIterator;
+  class IntrusiveConstIterator;
+
+ public:  // members
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using pointer = T *;
+  using iterator = IntrusiveIterator;
+  using const_iterator = IntrusiveConstIterator;
+  using size_type = std::size_t;
+
+ private:  // attributes
+  size_type size_ = 0;
+  IntrusiveListHook end_;
+
+ public:  // constructors
+  IntrusiveList();
+  IntrusiveList(const IntrusiveList &) = delete;
+  IntrusiveList(IntrusiveList &&l) noexcept;
+  IntrusiveList &operator=(const IntrusiveList &) = delete;
+  IntrusiveList &operator=(IntrusiveList &&l) noexcept;
+  ~IntrusiveList();
+
+ public:  // accessors
+  reference front();
+  const_reference front() const;
+  reference back();
+  const_reference back() const;
+
+ public:  // iterators
+  iterator begin() noexcept;
+  const_iterator begin() const noexcept;
+  const_iterator cbegin() const noexcept;
+  iterator end() noexcept;
+  const_iterator end() const noexcept;
+  const_iterator cend() const noexcept;
+  static iterator iterator_to(reference value) noexcept;
+
+ public:  // capacity
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type max_size() const noexcept;
+
+ public:  // modifiers
+  void clear() noexcept;
+  iterator insert(const_iterator pos, reference value) noexcept;
+  iterator erase(const_iterator pos) noexcept;
+  iterator erase(reference value) noexcept;
+  void push_back(reference value) noexcept;
+  void pop_back() noexcept;
+  void push_front(reference value) noexcept;
+  void pop_front() noexcept;
+  void swap(IntrusiveList &other) noexcept;
+  void splice(const_iterator pos, IntrusiveList &other) noexcept;
+  void splice(const_iterator pos, IntrusiveList &other,
+              const_iterator it) noexcept;
+  void splice(const_iterator pos, IntrusiveList &other, const_iterator first,
+              const_iterator last) noexcept;
+  void reverse() noexcept;
+
+ private:  // helpers
+  static T *owner(IntrusiveListHook *hook) noexcept;
+  static std::ptrdiff_t hook_offset() noexcept;
+  static void unlink(IntrusiveListHook *first,
+                     IntrusiveListHook *last) noexcept;
+  static void link_before(IntrusiveListHook *pos, IntrusiveListHook *first,
+                          IntrusiveListHook *last) noexcept;
+  void take_hooks(IntrusiveList &other) noexcept;
+};
+
+template <typename T, IntrusiveListHook T::*Hook>
+class IntrusiveList<T, Hook>::IntrusiveIterator {
+  friend class IntrusiveList;
+
+ public:
+  IntrusiveIterator() = default;
+  explicit IntrusiveIterator(IntrusiveListHook *hook) : it_(hook){};
+  IntrusiveIterator(const const_iterator &other) : it_(other.it_){};
+
+  iterator &operator++() {
+    it_ = it_->next_;
+    return *this;
+  }
+
+  iterator &operator--() {
+    it_ = it_->prev_;
+    return *this;
+  }
+
+  reference operator*() const { return *owner(it_); }
+  pointer operator->() const { return owner(it_); }
+
+  bool operator==(const iterator &other) const { return it_ == other.it_; }
+
+  bool operator!=(const iterator &other) const { return it_ != other.it_; }
+
+ private:
+  IntrusiveListHook *it_ = nullptr;
+};
+
+template <typename T, IntrusiveListHook T::*Hook>
+class IntrusiveList<T, Hook>::IntrusiveConstIterator {
+  friend class IntrusiveList;
+
+ public:
+  IntrusiveConstIterator() = default;
+  explicit IntrusiveConstIterator(IntrusiveListHook *hook) : it_(hook){};
+  IntrusiveConstIterator(const iterator &other) : it_(other.it_){};
+
+  const_iterator &operator++() {
+    it_ = it_->next_;
+    return *this;
+  }
+
+  const_iterator &operator--() {
+    it_ = it_->prev_;
+    return *this;
+  }
+
+  const_reference operator*() const { return *owner(it_); }
+  const T *operator->() const { return owner(it_); }
+
+  bool operator==(const const_iterator &other) const {
+    return it_ == other.it_;
+  }
+
+  bool operator!=(const const_iterator &other) const {
+    return it_ != other.it_;
+  }
+
+ private:
+  IntrusiveListHook *it_ = nullptr;
+};
+
+template <typename T, IntrusiveListHook T::*Hook>
+IntrusiveList<T, Hook>::IntrusiveList() : size_(0) {
+  end_.next_ = end_.prev_ = &end_;
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+IntrusiveList<T, Hook>::IntrusiveList(IntrusiveList &&l) noexcept
+    : IntrusiveList() {
+  take_hooks(l);
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+IntrusiveList<T, Hook> &IntrusiveList<T, Hook>::operator=(
+    IntrusiveList &&l) noexcept {
+  if (this != &l) {
+    clear();
+    take_hooks(l);
+  }
+  return *this;
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+IntrusiveList<T, Hook>::~IntrusiveList() {
+  clear();
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+typename IntrusiveList<T, Hook>::reference IntrusiveList<T, Hook>::front() {
+  return *owner(end_.next_);
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+typename IntrusiveList<T, Hook>::const_reference
+IntrusiveList<T, Hook>::front() const {
+  return *owner(end_.next_);
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+typename IntrusiveList<T, Hook>::reference IntrusiveList<T, Hook>::back() {
+  return *owner(end_.prev_);
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+typename IntrusiveList<T, Hook>::const_reference
+IntrusiveList<T, Hook>::back() const {
+  return *owner(end_.prev_);
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+typename IntrusiveList<T, Hook>::iterator
+IntrusiveList<T, Hook>::begin() noexcept {
+  return iterator(end_.next_);
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+typename IntrusiveList<T, Hook>::const_iterator
+IntrusiveList<T, Hook>::begin() const noexcept {
+  return const_iterator(end_.next_);
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+typename IntrusiveList<T, Hook>::const_iterator
+IntrusiveList<T, Hook>::cbegin() const noexcept {
+  return begin();
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+typename IntrusiveList<T, Hook>::iterator
+IntrusiveList<T, Hook>::end() noexcept {
+  return iterator(&end_);
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+typename IntrusiveList<T, Hook>::const_iterator IntrusiveList<T, Hook>::end()
+    const noexcept {
+  return const_iterator(const_cast<IntrusiveListHook *>(&end_));
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+typename IntrusiveList<T, Hook>::const_iterator
+IntrusiveList<T, Hook>::cend() const noexcept {
+  return end();
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+typename IntrusiveList<T, Hook>::iterator IntrusiveList<T, Hook>::iterator_to(
+    reference value) noexcept {
+  return iterator(&(value.*Hook));
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+bool IntrusiveList<T, Hook>::empty() const noexcept {
+  return size_ == 0;
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+typename IntrusiveList<T, Hook>::size_type IntrusiveList<T, Hook>::size()
+    const noexcept {
+  return size_;
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+typename IntrusiveList<T, Hook>::size_type IntrusiveList<T, Hook>::max_size()
+    const noexcept {
+  return std::numeric_limits<std::size_t>::max() / sizeof(T);
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+void IntrusiveList<T, Hook>::clear() noexcept {
+  IntrusiveListHook *hook = end_.next_;
+  while (hook != &end_) {
+    IntrusiveListHook *next = hook->next_;
+    hook->next_ = hook->prev_ = nullptr;
+    hook = next;
+  }
+  end_.next_ = end_.prev_ = &end_;
+  size_ = 0;
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+typename IntrusiveList<T, Hook>::iterator IntrusiveList<T, Hook>::insert(
+    const_iterator pos, reference value) noexcept {
+  IntrusiveListHook *hook = &(value.*Hook);
+  link_before(pos.it_, hook, hook);
+  ++size_;
+  return iterator(hook);
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+typename IntrusiveList<T, Hook>::iterator IntrusiveList<T, Hook>::erase(
+    const_iterator pos) noexcept {
+  IntrusiveListHook *hook = pos.it_;
+  IntrusiveListHook *next = hook->next_;
+  unlink(hook, hook);
+  hook->next_ = hook->prev_ = nullptr;
+  --size_;
+  return iterator(next);
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+typename IntrusiveList<T, Hook>::iterator IntrusiveList<T, Hook>::erase(
+    reference value) noexcept {
+  return erase(iterator_to(value));
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+void IntrusiveList<T, Hook>::push_back(reference value) noexcept {
+  insert(end(), value);
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+void IntrusiveList<T, Hook>::push_front(reference value) noexcept {
+  insert(begin(), value);
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+void IntrusiveList<T, Hook>::pop_front() noexcept {
+  if (size_) erase(begin());
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+void IntrusiveList<T, Hook>::pop_back() noexcept {
+  if (size_) erase(const_iterator(end_.prev_));
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+void IntrusiveList<T, Hook>::swap(IntrusiveList &other) noexcept {
+  if (this == &other) return;
+  IntrusiveList tmp;
+  tmp.take_hooks(other);
+  other.take_hooks(*this);
+  take_hooks(tmp);
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+void IntrusiveList<T, Hook>::splice(const_iterator pos,
+                                    IntrusiveList &other) noexcept {
+  if (this == &other || other.empty()) return;
+  IntrusiveListHook *first = other.end_.next_;
+  IntrusiveListHook *last = other.end_.prev_;
+  unlink(first, last);
+  link_before(pos.it_, first, last);
+  size_ += other.size_;
+  other.size_ = 0;
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+void IntrusiveList<T, Hook>::splice(const_iterator pos, IntrusiveList &other,
+                                    const_iterator it) noexcept {
+  IntrusiveListHook *hook = it.it_;
+  if (hook == pos.it_ || hook->next_ == pos.it_) return;
+  unlink(hook, hook);
+  --other.size_;
+  link_before(pos.it_, hook, hook);
+  ++size_;
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+void IntrusiveList<T, Hook>::splice(const_iterator pos, IntrusiveList &other,
+                                    const_iterator first,
+                                    const_iterator last) noexcept {
+  if (first == last) return;
+  IntrusiveListHook *first_hook = first.it_;
+  IntrusiveListHook *last_hook = last.it_->prev_;
+  // Внутри одного списка размер не меняется, иначе отрезок нужно посчитать
+  if (this != &other) {
+    size_type count = 1;
+    for (IntrusiveListHook *hook = first_hook; hook != last_hook;
+         hook = hook->next_) {
+      ++count;
+    }
+    other.size_ -= count;
+    size_ += count;
+  }
+  unlink(first_hook, last_hook);
+  link_before(pos.it_, first_hook, last_hook);
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+void IntrusiveList<T, Hook>::reverse() noexcept {
+  IntrusiveListHook *hook = &end_;
+  do {
+    std::swap(hook->prev_, hook->next_);
+    hook = hook->prev_;
+  } while (hook != &end_);
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+T *IntrusiveList<T, Hook>::owner(IntrusiveListHook *hook) noexcept {
+  return reinterpret_cast<T *>(reinterpret_cast<char *>(hook) -
+                               hook_offset());
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+std::ptrdiff_t IntrusiveList<T, Hook>::hook_offset() noexcept {
+  // Смещение крюка внутри T; offsetof не принимает указатель на член
+  alignas(T) char probe[sizeof(T)];
+  const T *object = reinterpret_cast<const T *>(probe);
+  return reinterpret_cast<const char *>(&(object->*Hook)) - probe;
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+void IntrusiveList<T, Hook>::unlink(IntrusiveListHook *first,
+                                    IntrusiveListHook *last) noexcept {
+  first->prev_->next_ = last->next_;
+  last->next_->prev_ = first->prev_;
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+void IntrusiveList<T, Hook>::link_before(IntrusiveListHook *pos,
+                                         IntrusiveListHook *first,
+                                         IntrusiveListHook *last) noexcept {
+  IntrusiveListHook *prev = pos->prev_;
+  first->prev_ = prev;
+  last->next_ = pos;
+  prev->next_ = first;
+  pos->prev_ = last;
+}
+
+template <typename T, IntrusiveListHook T::*Hook>
+void IntrusiveList<T, Hook>::take_hooks(IntrusiveList &other) noexcept {
+  // Этот список пуст; элементы other перецепляются к собственному end_
+  end_.next_ = end_.prev_ = &end_;
+  if (other.size_) link_before(&end_, other.end_.next_, other.end_.prev_);
+  size_ = other.size_;
+  other.end_.next_ = other.end_.prev_ = &other.end_;
+  other.size_ = 0;
+}
+}  // namespace s21
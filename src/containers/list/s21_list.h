@@ -1,19 +1,29 @@
 #pragma once
 
 #include <algorithm>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
+#include "s21_node_pool.h"
 
 namespace s21 {
 template <typename T>
 class List {
  public:  // node
-  struct Node {
+  // Связи вынесены в базу: фиктивный узел end_ хранит только их
+  struct NodeBase {
+    NodeBase *next_ = nullptr;
+    NodeBase *prev_ = nullptr;
+  };
+
+  struct Node : NodeBase {
     T data_;
-    Node *next_ = nullptr;
-    Node *prev_ = nullptr;
-    explicit Node(T data) noexcept : data_(data){};
+    explicit Node(T data) noexcept : data_(std::move(data)) {}
 
     template <typename... Args>
-    explicit Node(Args &&...args) : data_(std::forward<Args>(args)...){};
+    explicit Node(Args &&...args) : data_(std::forward<Args>(args)...) {}
   };
 
  public:  // internal classes
@@ -28,11 +38,16 @@ class List {
   using iterator = ListIterator;
   using const_iterator = ListConstIterator;
   using size_type = std::size_t;
+  using pool_type = NodePool<Node>;
 
  private:  // attributes
   size_type size_ = 0;
-  pointer head_;
-  pointer tail_;
+  // Кольцо замыкается через end_: end_.next_ — первый узел, end_.prev_ —
+  // последний, у пустого списка оба указывают на сам end_
+  NodeBase end_;
+  // Пул узлов. Списки, обменявшиеся узлами через splice или merge, делят
+  // один пул, поэтому узлы переходят между ними без копирования
+  std::shared_ptr<pool_type> pool_;
 
  public:  // constructors
   List();
@@ -81,10 +96,41 @@ class List {
   void pop_front();
   void swap(List &other) noexcept;
   void merge(List &other);
+  template <typename Compare>
+  void merge(List &other, Compare comp);
   void splice(const_iterator pos, List &other);
+  void splice(const_iterator pos, List &other, const_iterator it);
+  void splice(const_iterator pos, List &other, const_iterator first,
+              const_iterator last);
   void reverse() noexcept;
   void unique();
   void sort();
+  template <typename Compare>
+  void sort(Compare comp);
+
+ private:  // sort helpers
+  static NodeBase *split(NodeBase *node, size_type count) noexcept;
+  template <typename Compare>
+  static NodeBase *merge_runs(NodeBase *left, NodeBase *right, Compare &comp,
+                              NodeBase *&last);
+  void relink(NodeBase *first) noexcept;
+  static reference value(NodeBase *node) noexcept;
+
+ private:  // splice helpers
+  static void unlink(NodeBase *first, NodeBase *last) noexcept;
+  static void link_before(NodeBase *pos, NodeBase *first,
+                          NodeBase *last) noexcept;
+  void take_nodes(List &other) noexcept;
+  void share_pool(List &other);
+
+ private:  // node allocation
+  void resolve_pool();
+  bool owns_pool() noexcept;
+  void *allocate_node();
+  void deallocate_node(Node *node) noexcept;
+  template <typename... Args>
+  Node *create_node(Args &&...args);
+  void destroy_node(Node *node) noexcept;
 };
 
 template <typename T>
@@ -93,7 +139,7 @@ class List<T>::ListIterator {
 
  public:
   ListIterator() = default;
-  ListIterator(pointer it) : it_(it){};
+  ListIterator(NodeBase *it) : it_(it){};
   ListIterator(ListConstIterator &other) : it_(other.it_){};
   ListIterator(ListIterator &&other) noexcept : it_(other.it_) {
     other.it_ = nullptr;
@@ -110,7 +156,7 @@ class List<T>::ListIterator {
     return *this;
   }
 
-  reference operator*() { return it_->data_; }
+  reference operator*() { return value(it_); }
 
   iterator &operator=(const const_iterator &other) {
     it_ = other.it_;
@@ -127,7 +173,7 @@ class List<T>::ListIterator {
   bool operator!=(const iterator &other) { return it_ != other.it_; }
 
  private:
-  pointer it_;
+  NodeBase *it_;
 };
 
 template <typename T>
@@ -136,7 +182,7 @@ class List<T>::ListConstIterator {
 
  public:
   ListConstIterator() = default;
-  ListConstIterator(pointer it) : it_(it){};
+  ListConstIterator(NodeBase *it) : it_(it){};
   ListConstIterator(ListConstIterator &other) : it_(other.it_){};
   ListConstIterator(ListConstIterator &&other) noexcept : it_(other.it_) {
     other.it_ = nullptr;
@@ -153,7 +199,7 @@ class List<T>::ListConstIterator {
     return *this;
   }
 
-  const_reference operator*() { return it_->data_; }
+  const_reference operator*() { return value(it_); }
 
   const_iterator &operator=(const iterator &other) {
     it_ = other.it_;
@@ -165,11 +211,13 @@ class List<T>::ListConstIterator {
   bool operator!=(const const_iterator &other) { return it_ != other.it_; }
 
  private:
-  pointer it_;
+  NodeBase *it_;
 };
 
 template <typename T>
-List<T>::List() : size_(0), head_(nullptr), tail_(nullptr) {}
+List<T>::List() : size_(0) {
+  end_.next_ = end_.prev_ = &end_;
+}
 
 template <typename T>
 List<T>::List(size_type n) : List() {
@@ -193,31 +241,25 @@ List<T>::List(const List &l) : List() {
 }
 
 template <typename T>
-List<T>::List(List &&l) noexcept
-    : size_(l.size_), head_(l.head_), tail_(l.tail_) {
-  l.size_ = 0;
-  l.head_ = nullptr;
-  l.tail_ = nullptr;
+List<T>::List(List &&l) noexcept : List() {
+  take_nodes(l);
+  pool_ = std::move(l.pool_);
 }
 
 template <typename T>
 List<T> &List<T>::operator=(List &&l) noexcept {
   if (this != &l) {
-    this->~List();
-    size_ = l.size_;
-    head_ = l.head_;
-    tail_ = l.tail_;
-
-    l.size_ = 0;
-    l.head_ = nullptr;
-    l.tail_ = nullptr;
+    clear();
+    take_nodes(l);
+    pool_ = std::move(l.pool_);
   }
   return *this;
 }
 
 template <typename T>
 List<T> &List<T>::operator=(const List &l) noexcept {
-  if (head_) clear();
+  if (this == &l) return *this;
+  clear();
   for (auto i = l.cbegin(); i != l.cend(); ++i) {
     push_back(*i);
   }
@@ -231,52 +273,52 @@ List<T>::~List() {
 
 template <typename T>
 typename List<T>::reference List<T>::front() {
-  return head_->data_;
+  return value(end_.next_);
 }
 
 template <typename T>
 typename List<T>::const_reference List<T>::front() const {
-  return head_->data_;
+  return value(end_.next_);
 }
 
 template <typename T>
 typename List<T>::reference List<T>::back() {
-  return tail_->data_;
+  return value(end_.prev_);
 }
 
 template <typename T>
 typename List<T>::const_reference List<T>::back() const {
-  return tail_->data_;
+  return value(end_.prev_);
 }
 
 template <typename T>
 typename List<T>::iterator List<T>::begin() noexcept {
-  return iterator(head_);
+  return iterator(end_.next_);
 }
 
 template <typename T>
 typename List<T>::const_iterator List<T>::begin() const noexcept {
-  return const_iterator(head_);
+  return const_iterator(end_.next_);
 }
 
 template <typename T>
 typename List<T>::const_iterator List<T>::cbegin() const noexcept {
-  return const_iterator(head_);
+  return const_iterator(end_.next_);
 }
 
 template <typename T>
 typename List<T>::iterator List<T>::end() noexcept {
-  return iterator(tail_->next_);
+  return iterator(&end_);
 }
 
 template <typename T>
 typename List<T>::const_iterator List<T>::end() const noexcept {
-  return const_iterator(tail_->next_);
+  return const_iterator(const_cast<NodeBase *>(&end_));
 }
 
 template <typename T>
 typename List<T>::const_iterator List<T>::cend() const noexcept {
-  return const_iterator(tail_->next_);
+  return end();
 }
 
 template <typename T>
@@ -296,7 +338,19 @@ typename List<T>::size_type List<T>::max_size() const noexcept {
 
 template <typename T>
 void List<T>::clear() noexcept {
-  while (head_) {
+  if (!pool_) return;
+  if (owns_pool()) {
+    // Пул принадлежит только этому списку: блоки освобождаются целиком
+    if (!std::is_trivially_destructible_v<T>) {
+      for (NodeBase *node = end_.next_; node != &end_; node = node->next_) {
+        static_cast<Node *>(node)->~Node();
+      }
+    }
+    pool_->release();
+    end_.next_ = end_.prev_ = &end_;
+    size_ = 0;
+  }
+  while (size_) {
     pop_front();
   }
 }
@@ -304,23 +358,10 @@ void List<T>::clear() noexcept {
 template <typename T>
 typename List<T>::iterator List<T>::insert(const_iterator pos,
                                            const_reference value) {
-  if (pos == cend()) {
-    push_back(value);
-    return iterator(tail_);
-  }
-  if (pos == cbegin()) {
-    push_front(value);
-    return iterator(head_);
-  } else {
-    pointer cur_node = pos.it_;
-    Node *new_node = new Node(value);
-    new_node->next_ = cur_node;
-    new_node->prev_ = cur_node->prev_;
-    cur_node->prev_->next_ = new_node;
-    cur_node->prev_ = new_node;
-    ++size_;
-    return iterator(new_node);
-  }
+  Node *new_node = create_node(value);
+  link_before(pos.it_, new_node, new_node);
+  ++size_;
+  return iterator(new_node);
 }
 
 template <typename T>
@@ -351,153 +392,329 @@ void List<T>::insert_many_front(Args &&...args) {
 
 template <typename T>
 typename List<T>::iterator List<T>::erase(const_iterator pos) {
-  if (pos.it_ == head_) {
-    pop_front();
-    return pos;
-  } else if (pos.it_ == tail_) {
-    pop_back();
-    return end();
-  } else {
-    pointer tmp = pos.it_;
-    tmp->next_->prev_ = tmp->prev_;
-    tmp->prev_->next_ = tmp->next_;
-    delete tmp;
-    --size_;
-    return pos.it_;
-  }
+  NodeBase *node = pos.it_;
+  NodeBase *next = node->next_;
+  unlink(node, node);
+  destroy_node(static_cast<Node *>(node));
+  --size_;
+  return iterator(next);
 }
 
 template <typename T>
 void List<T>::push_back(const_reference value) {
-  Node *new_node = new Node(value);
-  if (empty()) {
-    head_ = tail_ = new_node;
-  } else {
-    tail_->next_ = new_node;
-    new_node->prev_ = tail_;
-    tail_ = new_node;
-  }
+  Node *new_node = create_node(value);
+  link_before(&end_, new_node, new_node);
   ++size_;
 }
 
 template <typename T>
 void List<T>::push_front(const_reference value) {
-  Node *new_node = new Node(value);
-  if (empty()) {
-    head_ = tail_ = new_node;
-  } else {
-    head_->prev_ = new_node;
-    new_node->next_ = head_;
-    head_ = new_node;
-  }
+  Node *new_node = create_node(value);
+  link_before(end_.next_, new_node, new_node);
   ++size_;
 }
 
 template <typename T>
 void List<T>::pop_front() {
-  if (size_ == 1) {
-    delete head_;
-    head_ = tail_ = nullptr;
-    size_ = 0;
+  if (size_) erase(cbegin());
+}
+
+template <typename T>
+void List<T>::pop_back() {
+  if (size_) erase(const_iterator(end_.prev_));
+}
+
+template <typename T>
+void List<T>::swap(List &other) noexcept {
+  if (this == &other) return;
+  List tmp;
+  tmp.take_nodes(other);
+  other.take_nodes(*this);
+  take_nodes(tmp);
+  std::swap(pool_, other.pool_);
+}
+
+template <typename T>
+void List<T>::merge(List &other) {
+  merge(other, std::less<value_type>());
+}
+
+template <typename T>
+template <typename Compare>
+void List<T>::merge(List &other, Compare comp) {
+  if (this == &other || other.empty()) return;
+  share_pool(other);
+  // Оба кольца размыкаются в цепочки, оканчивающиеся nullptr; узлы
+  // перецепляются, значения не трогаются
+  end_.prev_->next_ = nullptr;
+  other.end_.prev_->next_ = nullptr;
+  NodeBase *left = size_ ? end_.next_ : nullptr;
+  NodeBase *last = nullptr;
+  relink(merge_runs(left, other.end_.next_, comp, last));
+  size_ += other.size_;
+  other.end_.next_ = other.end_.prev_ = &other.end_;
+  other.size_ = 0;
+}
+
+template <typename T>
+void List<T>::splice(const_iterator pos, List &other) {
+  if (this == &other || other.empty()) return;
+  share_pool(other);
+  NodeBase *first = other.end_.next_;
+  NodeBase *last = other.end_.prev_;
+  unlink(first, last);
+  link_before(pos.it_, first, last);
+  size_ += other.size_;
+  other.size_ = 0;
+}
+
+template <typename T>
+void List<T>::splice(const_iterator pos, List &other, const_iterator it) {
+  NodeBase *node = it.it_;
+  if (this == &other) {
+    if (node == pos.it_ || node->next_ == pos.it_) return;
+  } else {
+    share_pool(other);
+    --other.size_;
+    ++size_;
   }
-  if (size_ > 1) {
-    head_ = head_->next_;
-    delete head_->prev_;
-    head_->prev_ = nullptr;
-    --size_;
+  unlink(node, node);
+  link_before(pos.it_, node, node);
+}
+
+template <typename T>
+void List<T>::splice(const_iterator pos, List &other, const_iterator first,
+                     const_iterator last) {
+  if (first == last) return;
+  NodeBase *first_node = first.it_;
+  NodeBase *last_node = last.it_->prev_;
+  // Внутри одного списка размер не меняется, иначе отрезок нужно посчитать
+  if (this != &other) {
+    share_pool(other);
+    size_type count = 1;
+    for (NodeBase *node = first_node; node != last_node; node = node->next_) {
+      ++count;
+    }
+    other.size_ -= count;
+    size_ += count;
   }
+  unlink(first_node, last_node);
+  link_before(pos.it_, first_node, last_node);
 }
 
 template <typename T>
-void List<T>::pop_back() {
-  if (size_ == 1) {
-    delete tail_;
-    head_ = tail_ = nullptr;
-    size_ = 0;
+void List<T>::unlink(NodeBase *first, NodeBase *last) noexcept {
+  first->prev_->next_ = last->next_;
+  last->next_->prev_ = first->prev_;
+}
+
+template <typename T>
+void List<T>::link_before(NodeBase *pos, NodeBase *first,
+                          NodeBase *last) noexcept {
+  NodeBase *prev = pos->prev_;
+  first->prev_ = prev;
+  last->next_ = pos;
+  prev->next_ = first;
+  pos->prev_ = last;
+}
+
+template <typename T>
+void List<T>::take_nodes(List &other) noexcept {
+  // Этот список пуст; узлы other перецепляются к собственному end_
+  end_.next_ = end_.prev_ = &end_;
+  if (other.size_) link_before(&end_, other.end_.next_, other.end_.prev_);
+  size_ = other.size_;
+  other.end_.next_ = other.end_.prev_ = &other.end_;
+  other.size_ = 0;
+}
+
+template <typename T>
+void List<T>::share_pool(List &other) {
+  // Узлы other переходят к этому списку, поэтому оба списка должны держать
+  // один и тот же пул; пул other вливается в наш за O(1)
+  if (!other.pool_) return;
+  other.resolve_pool();
+  if (!pool_) {
+    pool_ = other.pool_;
+    pool_->share();
+    return;
   }
-  if (size_ > 1) {
-    tail_ = tail_->prev_;
-    delete tail_->next_;
-    tail_->next_ = nullptr;
-    --size_;
+  for (;;) {
+    resolve_pool();
+    if (pool_ == other.pool_) return;
+    if (other.pool_->merge_into(pool_)) {
+      other.pool_ = pool_;
+      return;
+    }
+    // Один из пулов успели влить в третий из другого потока
+    other.resolve_pool();
   }
 }
 
 template <typename T>
-void List<T>::swap(List &other) noexcept {
-  std::swap(head_, other.head_);
-  std::swap(tail_, other.tail_);
-  std::swap(size_, other.size_);
+void List<T>::resolve_pool() {
+  while (auto parent = pool_->parent()) {
+    pool_ = std::move(parent);
+  }
 }
 
 template <typename T>
-void List<T>::merge(List &other) {
-  if (other.head_) {
-    const_iterator it = cend();
-    splice(it, other);
-    sort();
+bool List<T>::owns_pool() noexcept {
+  // Остальные владельцы общего пула уже уничтожены: блокировки больше не нужны
+  if (pool_->shared() && pool_.use_count() == 1) pool_->unshare();
+  return !pool_->shared();
+}
+
+template <typename T>
+void *List<T>::allocate_node() {
+  if (!pool_) {
+    pool_ = std::make_shared<pool_type>();
+  } else if (pool_->shared() && pool_.use_count() == 1) {
+    pool_->unshare();
+  }
+  void *memory;
+  while (!(memory = pool_->allocate())) {
+    pool_ = pool_->parent();
   }
+  return memory;
 }
 
 template <typename T>
-void List<T>::splice(const_iterator pos, List &other) {
-  const_iterator it = const_iterator(pos.it_);
-  for (auto iter = other.begin(); iter != other.end(); ++iter) {
-    insert(it, *iter);
+void List<T>::deallocate_node(Node *node) noexcept {
+  while (!pool_->deallocate(node)) {
+    pool_ = pool_->parent();
   }
 }
 
+template <typename T>
+template <typename... Args>
+typename List<T>::Node *List<T>::create_node(Args &&...args) {
+  void *memory = allocate_node();
+  try {
+    return new (memory) Node(std::forward<Args>(args)...);
+  } catch (...) {
+    deallocate_node(static_cast<Node *>(memory));
+    throw;
+  }
+}
+
+template <typename T>
+void List<T>::destroy_node(Node *node) noexcept {
+  node->~Node();
+  deallocate_node(node);
+}
+
 template <typename T>
 void List<T>::sort() {
-  if (size_ <= 1) return;
+  sort(std::less<value_type>());
+}
 
-  bool swapped;
-  auto it1 = head_;
-  const Node *it2 = nullptr;
+template <typename T>
+template <typename Compare>
+void List<T>::sort(Compare comp) {
+  if (size_ <= 1) return;
 
-  do {
-    swapped = false;
-    while (it1->next_ != it2) {
-      if (it1->data_ > it1->next_->data_) {
-        std::swap(it1->data_, it1->next_->data_);
-        swapped = true;
+  // Восходящая сортировка слиянием: на каждом проходе сливаются соседние
+  // отрезки длины width. Кольцо размыкается, узлы перецепляются только по
+  // next_, prev_ и связи с end_ восстанавливаются в конце.
+  end_.prev_->next_ = nullptr;
+  NodeBase *head = end_.next_;
+  for (size_type width = 1; width < size_; width *= 2) {
+    NodeBase *rest = head;
+    NodeBase *merged = nullptr;
+    NodeBase *merged_tail = nullptr;
+    while (rest) {
+      NodeBase *left = rest;
+      NodeBase *right = split(left, width);
+      rest = split(right, width);
+      NodeBase *last = nullptr;
+      NodeBase *run = merge_runs(left, right, comp, last);
+      if (merged_tail) {
+        merged_tail->next_ = run;
+      } else {
+        merged = run;
       }
-      it1 = it1->next_;
+      merged_tail = last;
     }
-    it2 = it1;
-    it1 = head_;
-  } while (swapped);
+    head = merged;
+  }
+  relink(head);
 }
 
 template <typename T>
-void List<T>::reverse() noexcept {
-  if (size_ > 1) {
-    Node *tmp = head_;
-    for (size_type i = 0; i < size_; ++i) {
-      std::swap(tmp->prev_, tmp->next_);
-      tmp = tmp->prev_;
-    }
+typename List<T>::NodeBase *List<T>::split(NodeBase *node,
+                                           size_type count) noexcept {
+  for (size_type i = 1; node && i < count; ++i) {
+    node = node->next_;
+  }
+  if (!node) return nullptr;
+  NodeBase *rest = node->next_;
+  node->next_ = nullptr;
+  return rest;
+}
+
+template <typename T>
+template <typename Compare>
+typename List<T>::NodeBase *List<T>::merge_runs(NodeBase *left,
+                                               NodeBase *right,
+                                               Compare &comp,
+                                               NodeBase *&last) {
+  // При равенстве берётся узел из left, поэтому слияние устойчиво
+  NodeBase *head = nullptr;
+  NodeBase **link = &head;
+  last = nullptr;
+  while (left && right) {
+    NodeBase *&from = comp(value(right), value(left)) ? right : left;
+    *link = last = from;
+    link = &from->next_;
+    from = from->next_;
+  }
+  for (NodeBase *rest = left ? left : right; rest; rest = rest->next_) {
+    *link = last = rest;
+    link = &rest->next_;
+  }
+  return head;
+}
 
-    std::swap(head_, tail_);
+template <typename T>
+void List<T>::relink(NodeBase *first) noexcept {
+  // Цепочка по next_ снова замыкается в кольцо через end_
+  NodeBase *prev = &end_;
+  for (NodeBase *node = first; node; node = node->next_) {
+    node->prev_ = prev;
+    prev->next_ = node;
+    prev = node;
   }
+  prev->next_ = &end_;
+  end_.prev_ = prev;
+}
+
+template <typename T>
+typename List<T>::reference List<T>::value(NodeBase *node) noexcept {
+  return static_cast<Node *>(node)->data_;
+}
+
+template <typename T>
+void List<T>::reverse() noexcept {
+  NodeBase *node = &end_;
+  do {
+    std::swap(node->prev_, node->next_);
+    node = node->prev_;
+  } while (node != &end_);
 }
 
 template <typename T>
 void List<T>::unique() {
-  if (size_ > 1) {
-    iterator cur = begin();
-    iterator next = begin();
-    ++next;
-    while (next != end()) {
-      if (*cur == *next) {
-        const_iterator err;
-        err = next;
-        erase(err);
-        next = cur;
-        ++next;
-      } else {
-        cur = ++next;
-      }
+  if (size_ <= 1) return;
+  NodeBase *node = end_.next_;
+  while (node->next_ != &end_) {
+    NodeBase *next = node->next_;
+    if (value(node) == value(next)) {
+      unlink(next, next);
+      destroy_node(static_cast<Node *>(next));
+      --size_;
+    } else {
+      node = next;
     }
   }
 }
@@ -0,0 +1,189 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+
+namespace s21 {
+// Пул узлов фиксированного размера: память берётся крупными блоками
+// (ChunkNodes узлов за раз), освобождённые узлы возвращаются в список
+// свободных и переиспользуются без обращения к malloc/free.
+//
+// Когда узлы переходят между списками, пул источника за O(1) вливается в пул
+// приёмника (merge_into) и остаётся пустой заглушкой со ссылкой parent().
+// Пул одного списка работает без блокировок; общий пул (shared()) защищён
+// мьютексом, поэтому списки можно использовать из разных потоков.
+template <typename Node, std::size_t ChunkNodes = 256>
+class NodePool {
+  static_assert(ChunkNodes > 0, "ChunkNodes must be positive");
+
+ public:
+  NodePool() = default;
+  NodePool(const NodePool &) = delete;
+  NodePool &operator=(const NodePool &) = delete;
+  ~NodePool();
+
+  // nullptr и false означают, что пул уже влит в parent()
+  void *allocate();
+  bool deallocate(Node *node) noexcept;
+  void release() noexcept;
+  bool merge_into(const std::shared_ptr<NodePool> &root);
+  std::shared_ptr<NodePool> parent() const;
+
+  bool shared() const noexcept { return shared_; }
+  void share() noexcept;
+  void unshare() noexcept;
+
+ private:
+  union Slot {
+    Slot *next;
+    alignas(Node) unsigned char storage[sizeof(Node)];
+  };
+
+  struct Chunk {
+    Chunk *next;
+    Slot slots[ChunkNodes];
+  };
+
+  void *take();
+  void put(Slot *slot) noexcept;
+
+  Chunk *chunks_ = nullptr;
+  Chunk *chunks_tail_ = nullptr;
+  Slot *free_ = nullptr;
+  Slot *free_tail_ = nullptr;
+  std::size_t used_ = ChunkNodes;  // занятые слоты в первом блоке
+  std::shared_ptr<NodePool> parent_;
+  // Меняется только пока пулом владеет один список, поэтому читается без
+  // блокировки
+  bool shared_ = false;
+  mutable std::mutex mutex_;
+};
+
+template <typename Node, std::size_t ChunkNodes>
+NodePool<Node, ChunkNodes>::~NodePool() {
+  release();
+}
+
+template <typename Node, std::size_t ChunkNodes>
+void *NodePool<Node, ChunkNodes>::allocate() {
+  if (!shared_) return take();
+  std::lock_guard<std::mutex> lock(mutex_);
+  return parent_ ? nullptr : take();
+}
+
+template <typename Node, std::size_t ChunkNodes>
+bool NodePool<Node, ChunkNodes>::deallocate(Node *node) noexcept {
+  Slot *slot = reinterpret_cast<Slot *>(node);
+  if (!shared_) {
+    put(slot);
+    return true;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (parent_) return false;
+  put(slot);
+  return true;
+}
+
+template <typename Node, std::size_t ChunkNodes>
+void NodePool<Node, ChunkNodes>::release() noexcept {
+  while (chunks_) {
+    Chunk *next = chunks_->next;
+    ::operator delete(chunks_);
+    chunks_ = next;
+  }
+  chunks_tail_ = nullptr;
+  free_ = free_tail_ = nullptr;
+  used_ = ChunkNodes;
+}
+
+template <typename Node, std::size_t ChunkNodes>
+bool NodePool<Node, ChunkNodes>::merge_into(
+    const std::shared_ptr<NodePool> &root) {
+  std::unique_lock<std::mutex> own(mutex_, std::defer_lock);
+  std::unique_lock<std::mutex> other(root->mutex_, std::defer_lock);
+  if (shared_ && root->shared_) {
+    std::lock(own, other);
+  } else if (shared_) {
+    own.lock();
+  } else if (root->shared_) {
+    other.lock();
+  }
+  // Пока ждали блокировку, один из пулов мог сам стать заглушкой
+  if (parent_ || root->parent_) return false;
+
+  // Остаток первого блока уходит в список свободных: не больше ChunkNodes
+  while (chunks_ && used_ < ChunkNodes) put(&chunks_->slots[used_++]);
+  if (free_) {
+    free_tail_->next = root->free_;
+    if (!root->free_) root->free_tail_ = free_tail_;
+    root->free_ = free_;
+  }
+  if (chunks_) {
+    if (root->chunks_) {
+      // Первым остаётся текущий блок корня, из него ещё выдаются слоты
+      chunks_tail_->next = root->chunks_->next;
+      root->chunks_->next = chunks_;
+      if (root->chunks_tail_ == root->chunks_) {
+        root->chunks_tail_ = chunks_tail_;
+      }
+    } else {
+      root->chunks_ = chunks_;
+      root->chunks_tail_ = chunks_tail_;
+      root->used_ = ChunkNodes;
+    }
+  }
+  chunks_ = chunks_tail_ = nullptr;
+  free_ = free_tail_ = nullptr;
+  used_ = ChunkNodes;
+  parent_ = root;
+  share();
+  root->share();
+  return true;
+}
+
+template <typename Node, std::size_t ChunkNodes>
+std::shared_ptr<NodePool<Node, ChunkNodes>>
+NodePool<Node, ChunkNodes>::parent() const {
+  if (!shared_) return parent_;
+  std::lock_guard<std::mutex> lock(mutex_);
+  return parent_;
+}
+
+template <typename Node, std::size_t ChunkNodes>
+void NodePool<Node, ChunkNodes>::share() noexcept {
+  // Флаг пишется только при переходе: уже общий пул читают другие потоки
+  if (!shared_) shared_ = true;
+}
+
+template <typename Node, std::size_t ChunkNodes>
+void NodePool<Node, ChunkNodes>::unshare() noexcept {
+  // Блокировка синхронизирует с последними обращениями бывших владельцев
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!parent_) shared_ = false;
+}
+
+template <typename Node, std::size_t ChunkNodes>
+void *NodePool<Node, ChunkNodes>::take() {
+  if (free_) {
+    Slot *slot = free_;
+    free_ = slot->next;
+    return slot->storage;
+  }
+  if (used_ == ChunkNodes) {
+    Chunk *chunk = static_cast<Chunk *>(::operator new(sizeof(Chunk)));
+    chunk->next = chunks_;
+    if (!chunks_) chunks_tail_ = chunk;
+    chunks_ = chunk;
+    used_ = 0;
+  }
+  return chunks_->slots[used_++].storage;
+}
+
+template <typename Node, std::size_t ChunkNodes>
+void NodePool<Node, ChunkNodes>::put(Slot *slot) noexcept {
+  if (!free_) free_tail_ = slot;
+  slot->next = free_;
+  free_ = slot;
+}
+}  // namespace s21
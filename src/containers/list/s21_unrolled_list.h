@@ -0,0 +1,726 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+// Развёрнутый список: элементы хранятся в блоках по ChunkSize штук,
+// блоки связаны в кольцо через фиктивный блок end_, как узлы s21::List.
+// Интерфейс совпадает с s21::List; итераторы — пара (блок, индекс).
+template <typename T,
+          std::size_t ChunkSize = (256 / sizeof(T) > 4 ? 256 / sizeof(T) : 4)>
+class UnrolledList {
+  static_assert(ChunkSize > 1, "ChunkSize must be at least 2");
+
+ public:  // chunk
+  struct ChunkBase {
+    ChunkBase *next_ = nullptr;
+    ChunkBase *prev_ = nullptr;
+    std::size_t count_ = 0;
+  };
+
+  struct Chunk : ChunkBase {
+    alignas(T) unsigned char storage_[ChunkSize * sizeof(T)];
+    T *data() noexcept { return reinterpret_cast<T *>(storage_); }
+  };
+
+ public:  // internal classes
+  class UnrolledIterator;
+  class UnrolledConstIterator;
+
+ public:  // members
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = UnrolledIterator;
+  using const_iterator = UnrolledConstIterator;
+  using size_type = std::size_t;
+
+ private:  // attributes
+  size_type size_ = 0;
+  // end_.next_ — первый блок, end_.prev_ — последний; пустых блоков нет
+  ChunkBase end_;
+
+ public:  // constructors
+  UnrolledList();
+  explicit UnrolledList(size_type n);
+  UnrolledList(std::initializer_list<value_type> const &items);
+  UnrolledList(const UnrolledList &l);
+  UnrolledList(UnrolledList &&l) noexcept;
+  UnrolledList &operator=(UnrolledList &&l) noexcept;
+  UnrolledList &operator=(const UnrolledList &l);
+  ~UnrolledList();
+
+ public:  // accessors
+  reference front();
+  const_reference front() const;
+  reference back();
+  const_reference back() const;
+
+ public:  // iterators
+  iterator begin() noexcept;
+  const_iterator begin() const noexcept;
+  const_iterator cbegin() const noexcept;
+  iterator end() noexcept;
+  const_iterator end() const noexcept;
+  const_iterator cend() const noexcept;
+
+ public:  // capacity
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type max_size() const noexcept;
+
+ public:  // modifiers
+  void clear() noexcept;
+  iterator insert(const_iterator pos, const_reference value);
+  iterator insert(const_iterator pos, T &&value);
+
+  template <typename... Args>
+  iterator insert_many(const_iterator pos, Args &&...args);
+  template <typename... Args>
+  void insert_many_back(Args &&...args);
+  template <typename... Args>
+  void insert_many_front(Args &&...args);
+
+  iterator erase(const_iterator pos);
+  void push_back(const_reference value);
+  void pop_back();
+  void push_front(const_reference value);
+  void pop_front();
+  void swap(UnrolledList &other) noexcept;
+  void merge(UnrolledList &other);
+  template <typename Compare>
+  void merge(UnrolledList &other, Compare comp);
+  void splice(const_iterator pos, UnrolledList &other);
+  void splice(const_iterator pos, UnrolledList &other, const_iterator it);
+  void splice(const_iterator pos, UnrolledList &other, const_iterator first,
+              const_iterator last);
+  void reverse() noexcept;
+  void unique();
+  void sort();
+  template <typename Compare>
+  void sort(Compare comp);
+
+ private:  // chunk helpers
+  static T *data(ChunkBase *chunk) noexcept;
+  static Chunk *create_chunk();
+  static void destroy_chunk(ChunkBase *chunk) noexcept;
+  static void link_before(ChunkBase *pos, ChunkBase *first,
+                          ChunkBase *last) noexcept;
+  static void unlink(ChunkBase *first, ChunkBase *last) noexcept;
+  static void move_tail(ChunkBase *from, size_type index, ChunkBase *to);
+  void take_chunks(UnrolledList &other) noexcept;
+  template <typename U>
+  iterator emplace_at(const_iterator pos, U &&value);
+};
+
+template <typename T, std::size_t ChunkSize>
+class UnrolledList<T, ChunkSize>::UnrolledIterator {
+  friend class UnrolledList;
+
+ public:
+  UnrolledIterator() = default;
+  UnrolledIterator(ChunkBase *chunk, size_type index)
+      : chunk_(chunk), index_(index){};
+  UnrolledIterator(const const_iterator &other)
+      : chunk_(other.chunk_), index_(other.index_){};
+
+  iterator &operator++() {
+    if (++index_ == chunk_->count_) {
+      chunk_ = chunk_->next_;
+      index_ = 0;
+    }
+    return *this;
+  }
+
+  iterator &operator--() {
+    if (index_ == 0) {
+      chunk_ = chunk_->prev_;
+      index_ = chunk_->count_;
+    }
+    --index_;
+    return *this;
+  }
+
+  reference operator*() const { return data(chunk_)[index_]; }
+  T *operator->() const { return data(chunk_) + index_; }
+
+  bool operator==(const iterator &other) const {
+    return chunk_ == other.chunk_ && index_ == other.index_;
+  }
+
+  bool operator!=(const iterator &other) const { return !(*this == other); }
+
+ private:
+  ChunkBase *chunk_ = nullptr;
+  size_type index_ = 0;
+};
+
+template <typename T, std::size_t ChunkSize>
+class UnrolledList<T, ChunkSize>::UnrolledConstIterator {
+  friend class UnrolledList;
+
+ public:
+  UnrolledConstIterator() = default;
+  UnrolledConstIterator(ChunkBase *chunk, size_type index)
+      : chunk_(chunk), index_(index){};
+  UnrolledConstIterator(const iterator &other)
+      : chunk_(other.chunk_), index_(other.index_){};
+
+  const_iterator &operator++() {
+    if (++index_ == chunk_->count_) {
+      chunk_ = chunk_->next_;
+      index_ = 0;
+    }
+    return *this;
+  }
+
+  const_iterator &operator--() {
+    if (index_ == 0) {
+      chunk_ = chunk_->prev_;
+      index_ = chunk_->count_;
+    }
+    --index_;
+    return *this;
+  }
+
+  const_reference operator*() const { return data(chunk_)[index_]; }
+  const T *operator->() const { return data(chunk_) + index_; }
+
+  bool operator==(const const_iterator &other) const {
+    return chunk_ == other.chunk_ && index_ == other.index_;
+  }
+
+  bool operator!=(const const_iterator &other) const {
+    return !(*this == other);
+  }
+
+ private:
+  ChunkBase *chunk_ = nullptr;
+  size_type index_ = 0;
+};
+
+template <typename T, std::size_t ChunkSize>
+UnrolledList<T, ChunkSize>::UnrolledList() : size_(0) {
+  end_.next_ = end_.prev_ = &end_;
+}
+
+template <typename T, std::size_t ChunkSize>
+UnrolledList<T, ChunkSize>::UnrolledList(size_type n) : UnrolledList() {
+  for (size_type i = 0; i < n; ++i) {
+    push_back(T());
+  }
+}
+
+template <typename T, std::size_t ChunkSize>
+UnrolledList<T, ChunkSize>::UnrolledList(
+    std::initializer_list<value_type> const &items)
+    : UnrolledList() {
+  for (auto i = items.begin(); i != items.end(); ++i) {
+    push_back(*i);
+  }
+}
+
+template <typename T, std::size_t ChunkSize>
+UnrolledList<T, ChunkSize>::UnrolledList(const UnrolledList &l)
+    : UnrolledList() {
+  for (auto i = l.cbegin(); i != l.cend(); ++i) {
+    push_back(*i);
+  }
+}
+
+template <typename T, std::size_t ChunkSize>
+UnrolledList<T, ChunkSize>::UnrolledList(UnrolledList &&l) noexcept
+    : UnrolledList() {
+  take_chunks(l);
+}
+
+template <typename T, std::size_t ChunkSize>
+UnrolledList<T, ChunkSize> &UnrolledList<T, ChunkSize>::operator=(
+    UnrolledList &&l) noexcept {
+  if (this != &l) {
+    clear();
+    take_chunks(l);
+  }
+  return *this;
+}
+
+template <typename T, std::size_t ChunkSize>
+UnrolledList<T, ChunkSize> &UnrolledList<T, ChunkSize>::operator=(
+    const UnrolledList &l) {
+  if (this == &l) return *this;
+  clear();
+  for (auto i = l.cbegin(); i != l.cend(); ++i) {
+    push_back(*i);
+  }
+  return *this;
+}
+
+template <typename T, std::size_t ChunkSize>
+UnrolledList<T, ChunkSize>::~UnrolledList() {
+  clear();
+}
+
+template <typename T, std::size_t ChunkSize>
+typename UnrolledList<T, ChunkSize>::reference
+UnrolledList<T, ChunkSize>::front() {
+  return data(end_.next_)[0];
+}
+
+template <typename T, std::size_t ChunkSize>
+typename UnrolledList<T, ChunkSize>::const_reference
+UnrolledList<T, ChunkSize>::front() const {
+  return data(end_.next_)[0];
+}
+
+template <typename T, std::size_t ChunkSize>
+typename UnrolledList<T, ChunkSize>::reference
+UnrolledList<T, ChunkSize>::back() {
+  return data(end_.prev_)[end_.prev_->count_ - 1];
+}
+
+template <typename T, std::size_t ChunkSize>
+typename UnrolledList<T, ChunkSize>::const_reference
+UnrolledList<T, ChunkSize>::back() const {
+  return data(end_.prev_)[end_.prev_->count_ - 1];
+}
+
+template <typename T, std::size_t ChunkSize>
+typename UnrolledList<T, ChunkSize>::iterator
+UnrolledList<T, ChunkSize>::begin() noexcept {
+  return iterator(end_.next_, 0);
+}
+
+template <typename T, std::size_t ChunkSize>
+typename UnrolledList<T, ChunkSize>::const_iterator
+UnrolledList<T, ChunkSize>::begin() const noexcept {
+  return const_iterator(end_.next_, 0);
+}
+
+template <typename T, std::size_t ChunkSize>
+typename UnrolledList<T, ChunkSize>::const_iterator
+UnrolledList<T, ChunkSize>::cbegin() const noexcept {
+  return begin();
+}
+
+template <typename T, std::size_t ChunkSize>
+typename UnrolledList<T, ChunkSize>::iterator
+UnrolledList<T, ChunkSize>::end() noexcept {
+  return iterator(&end_, 0);
+}
+
+template <typename T, std::size_t ChunkSize>
+typename UnrolledList<T, ChunkSize>::const_iterator
+UnrolledList<T, ChunkSize>::end() const noexcept {
+  return const_iterator(const_cast<ChunkBase *>(&end_), 0);
+}
+
+template <typename T, std::size_t ChunkSize>
+typename UnrolledList<T, ChunkSize>::const_iterator
+UnrolledList<T, ChunkSize>::cend() const noexcept {
+  return end();
+}
+
+template <typename T, std::size_t ChunkSize>
+bool UnrolledList<T, ChunkSize>::empty() const noexcept {
+  return size_ == 0;
+}
+
+template <typename T, std::size_t ChunkSize>
+typename UnrolledList<T, ChunkSize>::size_type
+UnrolledList<T, ChunkSize>::size() const noexcept {
+  return size_;
+}
+
+template <typename T, std::size_t ChunkSize>
+typename UnrolledList<T, ChunkSize>::size_type
+UnrolledList<T, ChunkSize>::max_size() const noexcept {
+  return std::numeric_limits<std::size_t>::max() / sizeof(T);
+}
+
+template <typename T, std::size_t ChunkSize>
+void UnrolledList<T, ChunkSize>::clear() noexcept {
+  ChunkBase *chunk = end_.next_;
+  while (chunk != &end_) {
+    ChunkBase *next = chunk->next_;
+    destroy_chunk(chunk);
+    chunk = next;
+  }
+  end_.next_ = end_.prev_ = &end_;
+  size_ = 0;
+}
+
+template <typename T, std::size_t ChunkSize>
+typename UnrolledList<T, ChunkSize>::iterator
+UnrolledList<T, ChunkSize>::insert(const_iterator pos,
+                                   const_reference value) {
+  return emplace_at(pos, value);
+}
+
+template <typename T, std::size_t ChunkSize>
+typename UnrolledList<T, ChunkSize>::iterator
+UnrolledList<T, ChunkSize>::insert(const_iterator pos, T &&value) {
+  return emplace_at(pos, std::move(value));
+}
+
+template <typename T, std::size_t ChunkSize>
+template <typename U>
+typename UnrolledList<T, ChunkSize>::iterator
+UnrolledList<T, ChunkSize>::emplace_at(const_iterator pos, U &&value) {
+  // Копия делается до сдвигов: value может ссылаться на элемент списка
+  T item(std::forward<U>(value));
+  ChunkBase *chunk = pos.chunk_;
+  size_type index = pos.index_;
+  // Вставка перед первым элементом блока дописывает в конец предыдущего
+  if (index == 0 && chunk->prev_ != &end_ &&
+      chunk->prev_->count_ < ChunkSize) {
+    chunk = chunk->prev_;
+    index = chunk->count_;
+  }
+  if (chunk == &end_ || chunk->count_ == ChunkSize) {
+    Chunk *fresh = create_chunk();
+    if (chunk == &end_) {
+      link_before(&end_, fresh, fresh);
+      chunk = fresh;
+      index = 0;
+    } else {
+      // Полный блок делится пополам
+      link_before(chunk->next_, fresh, fresh);
+      move_tail(chunk, ChunkSize / 2, fresh);
+      if (index > chunk->count_) {
+        index -= chunk->count_;
+        chunk = fresh;
+      }
+    }
+  }
+
+  T *items = data(chunk);
+  size_type count = chunk->count_;
+  if (index == count) {
+    new (items + count) T(std::move(item));
+  } else {
+    new (items + count) T(std::move(items[count - 1]));
+    std::move_backward(items + index, items + count - 1, items + count);
+    items[index] = std::move(item);
+  }
+  ++chunk->count_;
+  ++size_;
+  return iterator(chunk, index);
+}
+
+template <typename T, std::size_t ChunkSize>
+template <typename... Args>
+typename UnrolledList<T, ChunkSize>::iterator
+UnrolledList<T, ChunkSize>::insert_many(const_iterator pos, Args &&...args) {
+  iterator it = pos;
+  for (const auto &arg : {args...}) {
+    it = insert(it, arg);
+    ++it;
+  }
+  return it;
+}
+
+template <typename T, std::size_t ChunkSize>
+template <typename... Args>
+void UnrolledList<T, ChunkSize>::insert_many_back(Args &&...args) {
+  for (const auto &arg : {args...}) {
+    push_back(arg);
+  }
+}
+
+template <typename T, std::size_t ChunkSize>
+template <typename... Args>
+void UnrolledList<T, ChunkSize>::insert_many_front(Args &&...args) {
+  for (const auto &arg : {args...}) {
+    push_front(arg);
+  }
+}
+
+template <typename T, std::size_t ChunkSize>
+typename UnrolledList<T, ChunkSize>::iterator
+UnrolledList<T, ChunkSize>::erase(const_iterator pos) {
+  ChunkBase *chunk = pos.chunk_;
+  size_type index = pos.index_;
+  T *items = data(chunk);
+  std::move(items + index + 1, items + chunk->count_, items + index);
+  items[--chunk->count_].~T();
+  --size_;
+
+  if (chunk->count_ == 0) {
+    ChunkBase *next = chunk->next_;
+    unlink(chunk, chunk);
+    destroy_chunk(chunk);
+    return iterator(next, 0);
+  }
+  // Полупустой блок забирает элементы следующего, если они помещаются
+  ChunkBase *next = chunk->next_;
+  if (next != &end_ && chunk->count_ < ChunkSize / 2 &&
+      chunk->count_ + next->count_ <= ChunkSize) {
+    move_tail(next, 0, chunk);
+    unlink(next, next);
+    destroy_chunk(next);
+  }
+  if (index == chunk->count_) return iterator(chunk->next_, 0);
+  return iterator(chunk, index);
+}
+
+template <typename T, std::size_t ChunkSize>
+void UnrolledList<T, ChunkSize>::push_back(const_reference value) {
+  emplace_at(end(), value);
+}
+
+template <typename T, std::size_t ChunkSize>
+void UnrolledList<T, ChunkSize>::push_front(const_reference value) {
+  emplace_at(begin(), value);
+}
+
+template <typename T, std::size_t ChunkSize>
+void UnrolledList<T, ChunkSize>::pop_front() {
+  if (size_) erase(begin());
+}
+
+template <typename T, std::size_t ChunkSize>
+void UnrolledList<T, ChunkSize>::pop_back() {
+  if (size_) erase(const_iterator(end_.prev_, end_.prev_->count_ - 1));
+}
+
+template <typename T, std::size_t ChunkSize>
+void UnrolledList<T, ChunkSize>::swap(UnrolledList &other) noexcept {
+  if (this == &other) return;
+  UnrolledList tmp;
+  tmp.take_chunks(other);
+  other.take_chunks(*this);
+  take_chunks(tmp);
+}
+
+template <typename T, std::size_t ChunkSize>
+void UnrolledList<T, ChunkSize>::merge(UnrolledList &other) {
+  merge(other, std::less<value_type>());
+}
+
+template <typename T, std::size_t ChunkSize>
+template <typename Compare>
+void UnrolledList<T, ChunkSize>::merge(UnrolledList &other, Compare comp) {
+  if (this == &other || other.empty()) return;
+  // Слияние переносом элементов в новые плотно заполненные блоки
+  UnrolledList result;
+  iterator left = begin();
+  iterator right = other.begin();
+  while (left != end() && right != other.end()) {
+    if (comp(*right, *left)) {
+      result.emplace_at(result.end(), std::move(*right));
+      ++right;
+    } else {
+      result.emplace_at(result.end(), std::move(*left));
+      ++left;
+    }
+  }
+  for (; left != end(); ++left) {
+    result.emplace_at(result.end(), std::move(*left));
+  }
+  for (; right != other.end(); ++right) {
+    result.emplace_at(result.end(), std::move(*right));
+  }
+  other.clear();
+  clear();
+  take_chunks(result);
+}
+
+template <typename T, std::size_t ChunkSize>
+void UnrolledList<T, ChunkSize>::splice(const_iterator pos,
+                                        UnrolledList &other) {
+  if (this == &other || other.empty()) return;
+  ChunkBase *before = pos.chunk_;
+  if (pos.index_ != 0) {
+    // Блок в точке вставки разрезается, дальше перецепляются целые блоки
+    Chunk *rest = create_chunk();
+    link_before(before->next_, rest, rest);
+    move_tail(before, pos.index_, rest);
+    before = rest;
+  }
+  ChunkBase *first = other.end_.next_;
+  ChunkBase *last = other.end_.prev_;
+  unlink(first, last);
+  link_before(before, first, last);
+  size_ += other.size_;
+  other.size_ = 0;
+}
+
+template <typename T, std::size_t ChunkSize>
+void UnrolledList<T, ChunkSize>::splice(const_iterator pos,
+                                        UnrolledList &other,
+                                        const_iterator it) {
+  if (pos == it) return;
+  // Элемент переносится перемещением: узлов, которые можно перецепить,
+  // здесь нет
+  const_iterator next = it;
+  if (this == &other && ++next == pos) return;
+  T value = std::move(data(it.chunk_)[it.index_]);
+  if (this == &other) {
+    // Стирание сдвигает элементы своего блока, поэтому pos пересчитывается
+    size_type offset = 0;
+    for (const_iterator i = cbegin(); i != pos; ++i) ++offset;
+    size_type erased = 0;
+    for (const_iterator i = cbegin(); i != it; ++i) ++erased;
+    erase(it);
+    if (erased < offset) --offset;
+    iterator target = begin();
+    for (size_type i = 0; i < offset; ++i) ++target;
+    emplace_at(target, std::move(value));
+  } else {
+    other.erase(it);
+    emplace_at(pos, std::move(value));
+  }
+}
+
+template <typename T, std::size_t ChunkSize>
+void UnrolledList<T, ChunkSize>::splice(const_iterator pos,
+                                        UnrolledList &other,
+                                        const_iterator first,
+                                        const_iterator last) {
+  if (first == last) return;
+  UnrolledList moved;
+  size_type count = 0;
+  for (const_iterator i = first; i != last; ++i) {
+    moved.emplace_at(moved.end(), std::move(data(i.chunk_)[i.index_]));
+    ++count;
+  }
+  if (this == &other) {
+    size_type offset = 0;
+    for (const_iterator i = cbegin(); i != pos; ++i) ++offset;
+    size_type start = 0;
+    for (const_iterator i = cbegin(); i != first; ++i) ++start;
+    iterator it = first;
+    for (size_type i = 0; i < count; ++i) it = erase(it);
+    if (start < offset) offset -= count;
+    iterator target = begin();
+    for (size_type i = 0; i < offset; ++i) ++target;
+    splice(target, moved);
+  } else {
+    iterator it = first;
+    for (size_type i = 0; i < count; ++i) it = other.erase(it);
+    splice(pos, moved);
+  }
+}
+
+template <typename T, std::size_t ChunkSize>
+void UnrolledList<T, ChunkSize>::reverse() noexcept {
+  ChunkBase *chunk = &end_;
+  do {
+    std::swap(chunk->prev_, chunk->next_);
+    chunk = chunk->prev_;
+    if (chunk != &end_) std::reverse(data(chunk), data(chunk) + chunk->count_);
+  } while (chunk != &end_);
+}
+
+template <typename T, std::size_t ChunkSize>
+void UnrolledList<T, ChunkSize>::unique() {
+  // Один проход с уплотнением каждого блока на месте
+  T *kept = nullptr;
+  ChunkBase *chunk = end_.next_;
+  while (chunk != &end_) {
+    T *items = data(chunk);
+    size_type write = 0;
+    for (size_type read = 0; read < chunk->count_; ++read) {
+      if (kept && *kept == items[read]) continue;
+      if (write != read) items[write] = std::move(items[read]);
+      kept = items + write++;
+    }
+    for (size_type i = write; i < chunk->count_; ++i) items[i].~T();
+    size_ -= chunk->count_ - write;
+    chunk->count_ = write;
+    ChunkBase *next = chunk->next_;
+    if (write == 0) {
+      unlink(chunk, chunk);
+      destroy_chunk(chunk);
+    }
+    chunk = next;
+  }
+}
+
+template <typename T, std::size_t ChunkSize>
+void UnrolledList<T, ChunkSize>::sort() {
+  sort(std::less<value_type>());
+}
+
+template <typename T, std::size_t ChunkSize>
+template <typename Compare>
+void UnrolledList<T, ChunkSize>::sort(Compare comp) {
+  if (size_ <= 1) return;
+  // Элементы сортируются во временном массиве и возвращаются на свои места,
+  // раскладка по блокам не меняется
+  std::vector<T> items;
+  items.reserve(size_);
+  for (iterator it = begin(); it != end(); ++it) {
+    items.push_back(std::move(*it));
+  }
+  std::stable_sort(items.begin(), items.end(), comp);
+  auto source = items.begin();
+  for (iterator it = begin(); it != end(); ++it, ++source) {
+    *it = std::move(*source);
+  }
+}
+
+template <typename T, std::size_t ChunkSize>
+T *UnrolledList<T, ChunkSize>::data(ChunkBase *chunk) noexcept {
+  return static_cast<Chunk *>(chunk)->data();
+}
+
+template <typename T, std::size_t ChunkSize>
+typename UnrolledList<T, ChunkSize>::Chunk *
+UnrolledList<T, ChunkSize>::create_chunk() {
+  return new Chunk;
+}
+
+template <typename T, std::size_t ChunkSize>
+void UnrolledList<T, ChunkSize>::destroy_chunk(ChunkBase *chunk) noexcept {
+  T *items = data(chunk);
+  for (size_type i = 0; i < chunk->count_; ++i) items[i].~T();
+  delete static_cast<Chunk *>(chunk);
+}
+
+template <typename T, std::size_t ChunkSize>
+void UnrolledList<T, ChunkSize>::link_before(ChunkBase *pos, ChunkBase *first,
+                                             ChunkBase *last) noexcept {
+  ChunkBase *prev = pos->prev_;
+  first->prev_ = prev;
+  last->next_ = pos;
+  prev->next_ = first;
+  pos->prev_ = last;
+}
+
+template <typename T, std::size_t ChunkSize>
+void UnrolledList<T, ChunkSize>::unlink(ChunkBase *first,
+                                        ChunkBase *last) noexcept {
+  first->prev_->next_ = last->next_;
+  last->next_->prev_ = first->prev_;
+}
+
+template <typename T, std::size_t ChunkSize>
+void UnrolledList<T, ChunkSize>::move_tail(ChunkBase *from, size_type index,
+                                           ChunkBase *to) {
+  // Элементы from[index, count) дописываются в конец to
+  T *source = data(from);
+  T *target = data(to);
+  for (size_type i = index; i < from->count_; ++i) {
+    new (target + to->count_++) T(std::move(source[i]));
+    source[i].~T();
+  }
+  from->count_ = index;
+}
+
+template <typename T, std::size_t ChunkSize>
+void UnrolledList<T, ChunkSize>::take_chunks(UnrolledList &other) noexcept {
+  // Этот список пуст; блоки other перецепляются к собственному end_
+  end_.next_ = end_.prev_ = &end_;
+  if (other.size_) link_before(&end_, other.end_.next_, other.end_.prev_);
+  size_ = other.size_;
+  other.end_.next_ = other.end_.prev_ = &other.end_;
+  other.size_ = 0;
+}
+}  // namespace s21
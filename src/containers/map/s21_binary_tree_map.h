@@ -1,5 +1,6 @@
 #pragma once
 #include <iostream>
+#include <limits>
 #include <vector>
 namespace s21 {
 template <typename Key, typename T>
@@ -25,9 +26,14 @@ class BinaryTreeMap {
     Node* left;
     Node* right;
     Node* parent;
+    bool red;
 
     Node(const_reference data, Node* parent_c = nullptr)
-        : data_(data), left(nullptr), right(nullptr), parent(parent_c) {}
+        : data_(data),
+          left(nullptr),
+          right(nullptr),
+          parent(parent_c),
+          red(true) {}
   };
 
   Node* root_;
@@ -55,16 +61,23 @@ class BinaryTreeMap {
   size_type size();
   size_type max_size();
   void clear();
+  bool contains(const Key& key) const;
 
   // Вспомогательные функции
  private:
   void delete_tree(Node*& node);
-  std::pair<iterator, bool> insert(Node*& node, Node* parent_node,
-                                   const_reference data, bool assign);
+  std::pair<iterator, bool> insert_node(const_reference data, bool assign);
   void replace_node(Node* old_node, Node* new_node);
   Node* find_min(Node* node) const;
   Node* find_node(Node* node, const Key& key) const;
 
+  // Балансировка красно-чёрного дерева
+  static bool is_red(const Node* node);
+  void rotate_left(Node* node);
+  void rotate_right(Node* node);
+  void insert_fixup(Node* node);
+  void erase_fixup(Node* node, Node* parent_node);
+
  public:  // iterators
   iterator begin();
   const_iterator cbegin() const;
@@ -191,19 +204,19 @@ void BinaryTreeMap<Key, T>::delete_tree(Node*& node) {
 template <typename Key, typename T>
 std::pair<typename BinaryTreeMap<Key, T>::iterator, bool>
 BinaryTreeMap<Key, T>::insert(const_reference data) {
-  return insert(root_, nullptr, data, false);
+  return insert_node(data, false);
 }
 
 template <typename Key, typename T>
 std::pair<typename BinaryTreeMap<Key, T>::iterator, bool>
 BinaryTreeMap<Key, T>::insert(const Key& key, const T& obj) {
-  return insert(root_, nullptr, std::make_pair(key, obj), false);
+  return insert_node(std::make_pair(key, obj), false);
 }
 
 template <typename Key, typename T>
 std::pair<typename BinaryTreeMap<Key, T>::iterator, bool>
 BinaryTreeMap<Key, T>::insert_or_assign(const Key& key, const T& obj) {
-  return insert(root_, nullptr, std::make_pair(key, obj), true);
+  return insert_node(std::make_pair(key, obj), true);
 }
 
 template <typename Key, typename T>
@@ -246,35 +259,39 @@ void BinaryTreeMap<Key, T>::clear() {
   delete_tree(root_);
 }
 
+template <typename Key, typename T>
+bool BinaryTreeMap<Key, T>::contains(const Key& key) const {
+  return find_node(root_, key) != nullptr;
+}
+
 template <typename Key, typename T>
 std::pair<typename BinaryTreeMap<Key, T>::iterator, bool>
-BinaryTreeMap<Key, T>::insert(typename BinaryTreeMap<Key, T>::Node*& node,
-                              typename BinaryTreeMap<Key, T>::Node* parent_node,
-                              const_reference data, bool assign) {
-  auto ans = std::make_pair(SetIterator(nullptr), true);
-  if (!node) {
-    ++size_;
-    node = new Node(data, parent_node);
-    ans.first = SetIterator(node);
-    ans.second = true;
-    return ans;
-  }
-  if (data.first < node->data_.first) {
-    ans = insert(node->left, node, data, assign);
-  } else if (data.first >
-             node->data_.first)  // !! для повторяющихся значений не пройдет
-  {
-    ans = insert(node->right, node, data, assign);
-  } else {
-    if (!assign) {
-      ans = std::make_pair(SetIterator(node), false);
+BinaryTreeMap<Key, T>::insert_node(const_reference data, bool assign) {
+  Node* parent_node = nullptr;
+  Node* node = root_;
+  while (node) {
+    parent_node = node;
+    if (data.first < node->data_.first) {
+      node = node->left;
+    } else if (data.first > node->data_.first) {
+      node = node->right;
     } else {
-      ans = std::make_pair(SetIterator(node), true);
-      node->data_.second = data.second;
+      if (assign) node->data_.second = data.second;
+      return std::make_pair(SetIterator(node), assign);
     }
   }
 
-  return ans;
+  node = new Node(data, parent_node);
+  if (!parent_node) {
+    root_ = node;
+  } else if (data.first < parent_node->data_.first) {
+    parent_node->left = node;
+  } else {
+    parent_node->right = node;
+  }
+  ++size_;
+  insert_fixup(node);
+  return std::make_pair(SetIterator(node), true);
 }
 
 template <typename Key, typename T>
@@ -283,40 +300,178 @@ void BinaryTreeMap<Key, T>::erase(SetIterator pos) {
   if (!node_to_remove)
     return;  // Проверяем, что итератор указывает на допустимый элемент
   --size_;
-  // 1. Узел не имеет детей
-  if (node_to_remove->left == nullptr && node_to_remove->right == nullptr) {
-    replace_node(node_to_remove, nullptr);
-    delete node_to_remove;
-  }
-  // 2. Узел имеет только одного ребёнка
-  else if (node_to_remove->left == nullptr) {
+  // Узел, который фактически уходит из дерева, и его цвет
+  bool removed_red = node_to_remove->red;
+  // Узел, встающий на освободившееся место, и его родитель
+  Node* child = nullptr;
+  Node* child_parent = nullptr;
+  // 1-2. Узел имеет не более одного ребёнка
+  if (node_to_remove->left == nullptr) {
+    child = node_to_remove->right;
+    child_parent = node_to_remove->parent;
     replace_node(node_to_remove, node_to_remove->right);
-    delete node_to_remove;
   } else if (node_to_remove->right == nullptr) {
+    child = node_to_remove->left;
+    child_parent = node_to_remove->parent;
     replace_node(node_to_remove, node_to_remove->left);
-    delete node_to_remove;
   }
   // 3. Узел имеет двух детей
   else {
     // Ищем наименьший элемент в правом поддереве (заменяющий узел)
     Node* successor = find_min(node_to_remove->right);
+    removed_red = successor->red;
+    child = successor->right;
 
     // Заменяем node_to_remove на successor (заменяющий узел)
     if (successor->parent != node_to_remove) {
+      child_parent = successor->parent;
       replace_node(successor,
                    successor->right);  // Перемещаем потомков заменяющего узла
       successor->right = node_to_remove->right;  // Переставляем правого ребёнка
-      if (successor->right) {
-        successor->right->parent = successor;
-      }
+      successor->right->parent = successor;
+    } else {
+      child_parent = successor;
     }
     replace_node(node_to_remove, successor);  // Перемещаем заменяющий узел
     successor->left = node_to_remove->left;  // Переставляем левого ребёнка
-    if (successor->left) {
-      successor->left->parent = successor;
+    successor->left->parent = successor;
+    successor->red = node_to_remove->red;
+  }
+  delete node_to_remove;
+
+  // Удаление чёрного узла нарушает чёрную высоту
+  if (!removed_red) erase_fixup(child, child_parent);
+}
+
+template <typename Key, typename T>
+bool BinaryTreeMap<Key, T>::is_red(const Node* node) {
+  return node && node->red;
+}
+
+template <typename Key, typename T>
+void BinaryTreeMap<Key, T>::rotate_left(Node* node) {
+  Node* pivot = node->right;
+  node->right = pivot->left;
+  if (pivot->left) pivot->left->parent = node;
+  replace_node(node, pivot);
+  pivot->left = node;
+  node->parent = pivot;
+}
+
+template <typename Key, typename T>
+void BinaryTreeMap<Key, T>::rotate_right(Node* node) {
+  Node* pivot = node->left;
+  node->left = pivot->right;
+  if (pivot->right) pivot->right->parent = node;
+  replace_node(node, pivot);
+  pivot->right = node;
+  node->parent = pivot;
+}
+
+template <typename Key, typename T>
+void BinaryTreeMap<Key, T>::insert_fixup(Node* node) {
+  // Новый узел красный: чиним только случай "красный родитель"
+  while (is_red(node->parent)) {
+    Node* parent_node = node->parent;
+    Node* grandparent = parent_node->parent;
+    if (parent_node == grandparent->left) {
+      Node* uncle = grandparent->right;
+      if (is_red(uncle)) {
+        // Красный дядя: перекрашиваем и поднимаемся выше
+        parent_node->red = false;
+        uncle->red = false;
+        grandparent->red = true;
+        node = grandparent;
+      } else {
+        // Чёрный дядя: один или два поворота
+        if (node == parent_node->right) {
+          node = parent_node;
+          rotate_left(node);
+          parent_node = node->parent;
+        }
+        parent_node->red = false;
+        grandparent->red = true;
+        rotate_right(grandparent);
+      }
+    } else {
+      Node* uncle = grandparent->left;
+      if (is_red(uncle)) {
+        parent_node->red = false;
+        uncle->red = false;
+        grandparent->red = true;
+        node = grandparent;
+      } else {
+        if (node == parent_node->left) {
+          node = parent_node;
+          rotate_right(node);
+          parent_node = node->parent;
+        }
+        parent_node->red = false;
+        grandparent->red = true;
+        rotate_left(grandparent);
+      }
+    }
+  }
+  root_->red = false;
+}
+
+template <typename Key, typename T>
+void BinaryTreeMap<Key, T>::erase_fixup(Node* node, Node* parent_node) {
+  // node несёт "лишний чёрный"; node может быть nullptr (чёрный лист)
+  while (node != root_ && !is_red(node)) {
+    if (node == parent_node->left) {
+      Node* sibling = parent_node->right;
+      if (is_red(sibling)) {
+        sibling->red = false;
+        parent_node->red = true;
+        rotate_left(parent_node);
+        sibling = parent_node->right;
+      }
+      if (!is_red(sibling->left) && !is_red(sibling->right)) {
+        sibling->red = true;
+        node = parent_node;
+        parent_node = node->parent;
+      } else {
+        if (!is_red(sibling->right)) {
+          sibling->left->red = false;
+          sibling->red = true;
+          rotate_right(sibling);
+          sibling = parent_node->right;
+        }
+        sibling->red = parent_node->red;
+        parent_node->red = false;
+        sibling->right->red = false;
+        rotate_left(parent_node);
+        node = root_;
+      }
+    } else {
+      Node* sibling = parent_node->left;
+      if (is_red(sibling)) {
+        sibling->red = false;
+        parent_node->red = true;
+        rotate_right(parent_node);
+        sibling = parent_node->left;
+      }
+      if (!is_red(sibling->left) && !is_red(sibling->right)) {
+        sibling->red = true;
+        node = parent_node;
+        parent_node = node->parent;
+      } else {
+        if (!is_red(sibling->left)) {
+          sibling->right->red = false;
+          sibling->red = true;
+          rotate_left(sibling);
+          sibling = parent_node->left;
+        }
+        sibling->red = parent_node->red;
+        parent_node->red = false;
+        sibling->left->red = false;
+        rotate_right(parent_node);
+        node = root_;
+      }
     }
-    delete node_to_remove;
   }
+  if (node) node->red = false;
 }
 
 template <typename Key, typename T>
@@ -0,0 +1,784 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+// Упорядоченный словарь на B+-дереве с интерфейсом s21::Map. Узел занимает
+// около NodeBytes байт: ключи лежат подряд в одном массиве, значения —
+// в другом, поэтому поиск внутри узла идёт по соседним кэш-линиям, а
+// высота дерева — единицы уровней даже для десятков миллионов ключей.
+// Пары хранятся только в листьях, связанных в двусвязный список; внутренние
+// узлы держат копии ключей-разделителей. Разыменование итератора даёт
+// std::pair<const Key&, T&>. Итераторы инвалидируются вставкой и удалением.
+template <typename Key, typename T, std::size_t NodeBytes = 512>
+class BTreeMap {
+ public:  // members
+  template <bool Const>
+  class BTreeIterator;
+
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using size_type = std::size_t;
+  using iterator = BTreeIterator<false>;
+  using const_iterator = BTreeIterator<true>;
+
+ private:  // node layout
+  static constexpr size_type kHeader = 4 * sizeof(void*);
+  static constexpr size_type fit(size_type bytes, size_type per_slot) {
+    return bytes > kHeader && (bytes - kHeader) / per_slot > 4
+               ? (bytes - kHeader) / per_slot
+               : 4;
+  }
+
+ public:  // node capacity
+  static constexpr size_type kLeafSlots =
+      fit(NodeBytes, sizeof(Key) + sizeof(T));
+  static constexpr size_type kInnerSlots =
+      fit(NodeBytes, sizeof(Key) + sizeof(void*));
+
+ private:  // nodes
+  static constexpr size_type kLeafMin = kLeafSlots / 2;
+  static constexpr size_type kInnerMin = kInnerSlots / 2;
+  // Минимальное ветвление 3 ограничивает высоту дерева
+  static constexpr size_type kMaxDepth = 48;
+
+  struct Node {
+    explicit Node(bool is_leaf) : leaf(is_leaf) {}
+    bool leaf;
+    size_type count = 0;
+  };
+
+  struct Leaf : Node {
+    Leaf() : Node(true) {}
+    Key* keys() noexcept { return reinterpret_cast<Key*>(key_storage); }
+    T* values() noexcept { return reinterpret_cast<T*>(value_storage); }
+
+    Leaf* prev = nullptr;
+    Leaf* next = nullptr;
+    alignas(Key) unsigned char key_storage[kLeafSlots * sizeof(Key)];
+    alignas(T) unsigned char value_storage[kLeafSlots * sizeof(T)];
+  };
+
+  // Запасной слот позволяет сначала вставить разделитель, а потом делить
+  struct Inner : Node {
+    Inner() : Node(false) {}
+    Key* keys() noexcept { return reinterpret_cast<Key*>(key_storage); }
+
+    alignas(Key) unsigned char key_storage[(kInnerSlots + 1) * sizeof(Key)];
+    Node* children[kInnerSlots + 2];
+  };
+
+  // Путь от корня до листа: внутренние узлы и номера пройденных потомков
+  struct Path {
+    Inner* nodes[kMaxDepth];
+    size_type slots[kMaxDepth];
+    size_type depth = 0;
+  };
+
+ private:  // attributes
+  Node* root_;
+  Leaf* first_;
+  Leaf* last_;
+  size_type size_;
+
+ public:  // constructors
+  BTreeMap();
+  BTreeMap(std::initializer_list<value_type> const& items);
+  BTreeMap(const BTreeMap& other);
+  BTreeMap(BTreeMap&& other) noexcept;
+  ~BTreeMap();
+
+  BTreeMap& operator=(BTreeMap&& other) noexcept;
+  BTreeMap& operator=(const BTreeMap& other);
+
+ public:  // iterators
+  iterator begin() noexcept;
+  iterator end() noexcept;
+  const_iterator begin() const noexcept;
+  const_iterator end() const noexcept;
+  const_iterator cbegin() const noexcept;
+  const_iterator cend() const noexcept;
+
+ public:  // capacity
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type max_size() const noexcept;
+
+ public:  // modifiers
+  void clear() noexcept;
+  std::pair<iterator, bool> insert(const_reference value);
+  std::pair<iterator, bool> insert(const Key& key, const T& obj);
+  std::pair<iterator, bool> insert_or_assign(const Key& key, const T& obj);
+  template <typename... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args&&... args);
+  void erase(iterator pos);
+  void swap(BTreeMap& other) noexcept;
+  void merge(BTreeMap& other);
+
+ public:  // lookup
+  iterator find(const Key& key);
+  const_iterator find(const Key& key) const;
+  bool contains(const Key& key) const;
+  T& at(const Key& key);
+  const T& at(const Key& key) const;
+  T& operator[](const Key& key);
+
+ private:  // helpers
+  static bool less(const Key& a, const Key& b) {
+    return std::less<Key>()(a, b);
+  }
+  std::pair<Leaf*, size_type> locate(const Key& key, Path* path) const;
+  template <typename V>
+  std::pair<iterator, bool> emplace_key(const Key& key, V&& value,
+                                        bool assign);
+  std::pair<Leaf*, size_type> split_leaf(Leaf* leaf, size_type pos,
+                                         const Key& key, T&& value,
+                                         Path& path);
+  void insert_into_parent(Path& path, Node* left, const Key& separator,
+                          Node* right);
+  void rebalance_leaf(Path& path, Leaf* leaf);
+  void rebalance_inner(Path& path, size_type level);
+  static void leaf_insert(Leaf* leaf, size_type pos, const Key& key,
+                          T&& value);
+  static void leaf_move(Leaf* from, size_type i, Leaf* to, size_type j);
+  static void leaf_erase(Leaf* leaf, size_type pos);
+  static void inner_erase(Inner* inner, size_type key_pos);
+  static void destroy(Node* node) noexcept;
+};
+
+template <typename Key, typename T, std::size_t NodeBytes>
+template <bool Const>
+class BTreeMap<Key, T, NodeBytes>::BTreeIterator {
+ public:  // members
+  using mapped_reference = std::conditional_t<Const, const T&, T&>;
+  using value_type = std::pair<const Key&, mapped_reference>;
+  using map_pointer = std::conditional_t<Const, const BTreeMap*, BTreeMap*>;
+
+ public:  // constructors
+  BTreeIterator() = default;
+  BTreeIterator(map_pointer map, Leaf* leaf, size_type index)
+      : map_(map), leaf_(leaf), index_(index) {}
+  // Неконстантный итератор приводится к константному
+  template <bool Other, typename = std::enable_if_t<Const && !Other>>
+  BTreeIterator(const BTreeIterator<Other>& other)
+      : map_(other.map_), leaf_(other.leaf_), index_(other.index_) {}
+
+ public:  // access
+  value_type operator*() const {
+    return value_type(leaf_->keys()[index_], leaf_->values()[index_]);
+  }
+  const Key& key() const { return leaf_->keys()[index_]; }
+  mapped_reference value() const { return leaf_->values()[index_]; }
+
+ public:  // movement
+  BTreeIterator& operator++() {
+    if (leaf_ && ++index_ == leaf_->count) {
+      leaf_ = leaf_->next;
+      index_ = 0;
+    }
+    return *this;
+  }
+  BTreeIterator& operator--() {
+    if (!leaf_) {
+      leaf_ = map_->last_;
+      index_ = leaf_ ? leaf_->count - 1 : 0;
+    } else if (index_ == 0) {
+      leaf_ = leaf_->prev;
+      index_ = leaf_ ? leaf_->count - 1 : 0;
+    } else {
+      --index_;
+    }
+    return *this;
+  }
+  BTreeIterator operator++(int) {
+    BTreeIterator old = *this;
+    ++*this;
+    return old;
+  }
+  BTreeIterator operator--(int) {
+    BTreeIterator old = *this;
+    --*this;
+    return old;
+  }
+
+  bool operator==(const BTreeIterator& other) const {
+    return leaf_ == other.leaf_ && index_ == other.index_;
+  }
+  bool operator!=(const BTreeIterator& other) const {
+    return !(*this == other);
+  }
+
+ private:  // attributes
+  friend class BTreeMap;
+  template <bool>
+  friend class BTreeIterator;
+  map_pointer map_ = nullptr;
+  Leaf* leaf_ = nullptr;
+  size_type index_ = 0;
+};
+
+template <typename Key, typename T, std::size_t NodeBytes>
+BTreeMap<Key, T, NodeBytes>::BTreeMap()
+    : root_(nullptr), first_(nullptr), last_(nullptr), size_(0) {}
+
+template <typename Key, typename T, std::size_t NodeBytes>
+BTreeMap<Key, T, NodeBytes>::BTreeMap(
+    std::initializer_list<value_type> const& items)
+    : BTreeMap() {
+  for (const auto& item : items) insert(item);
+}
+
+template <typename Key, typename T, std::size_t NodeBytes>
+BTreeMap<Key, T, NodeBytes>::BTreeMap(const BTreeMap& other) : BTreeMap() {
+  // Ключи идут по возрастанию, поэтому листья заполняются целиком
+  for (auto it = other.cbegin(); it != other.cend(); ++it) {
+    insert(it.key(), it.value());
+  }
+}
+
+template <typename Key, typename T, std::size_t NodeBytes>
+BTreeMap<Key, T, NodeBytes>::BTreeMap(BTreeMap&& other) noexcept
+    : root_(other.root_),
+      first_(other.first_),
+      last_(other.last_),
+      size_(other.size_) {
+  other.root_ = nullptr;
+  other.first_ = other.last_ = nullptr;
+  other.size_ = 0;
+}
+
+template <typename Key, typename T, std::size_t NodeBytes>
+BTreeMap<Key, T, NodeBytes>::~BTreeMap() {
+  clear();
+}
+
+template <typename Key, typename T, std::size_t NodeBytes>
+BTreeMap<Key, T, NodeBytes>& BTreeMap<Key, T, NodeBytes>::operator=(
+    BTreeMap&& other) noexcept {
+  if (this != &other) {
+    BTreeMap tmp(std::move(other));
+    swap(tmp);
+  }
+  return *this;
+}
+
+template <typename Key, typename T, std::size_t NodeBytes>
+BTreeMap<Key, T, NodeBytes>& BTreeMap<Key, T, NodeBytes>::operator=(
+    const BTreeMap& other) {
+  if (this != &other) {
+    BTreeMap tmp(other);
+    swap(tmp);
+  }
+  return *this;
+}
+
+template <typename Key, typename T, std::size_t NodeBytes>
+typename BTreeMap<Key, T, NodeBytes>::iterator
+BTreeMap<Key, T, NodeBytes>::begin() noexcept {
+  return iterator(this, first_, 0);
+}
+
+template <typename Key, typename T, std::size_t NodeBytes>
+typename BTreeMap<Key, T, NodeBytes>::iterator
+BTreeMap<Key, T, NodeBytes>::end() noexcept {
+  return iterator(this, nullptr, 0);
+}
+
+template <typename Key, typename T, std::size_t NodeBytes>
+typename BTreeMap<Key, T, NodeBytes>::const_iterator
+BTreeMap<Key, T, NodeBytes>::begin() const noexcept {
+  return const_iterator(this, first_, 0);
+}
+
+template <typename Key, typename T, std::size_t NodeBytes>
+typename BTreeMap<Key, T, NodeBytes>::const_iterator
+BTreeMap<Key, T, NodeBytes>::end() const noexcept {
+  return const_iterator(this, nullptr, 0);
+}
+
+template <typename Key, typename T, std::size_t NodeBytes>
+typename BTreeMap<Key, T, NodeBytes>::const_iterator
+BTreeMap<Key, T, NodeBytes>::cbegin() const noexcept {
+  return begin();
+}
+
+template <typename Key, typename T, std::size_t NodeBytes>
+typename BTreeMap<Key, T, NodeBytes>::const_iterator
+BTreeMap<Key, T, NodeBytes>::cend() const noexcept {
+  return end();
+}
+
+template <typename Key, typename T, std::size_t NodeBytes>
+bool BTreeMap<Key, T, NodeBytes>::empty() const noexcept {
+  return size_ == 0;
+}
+
+template <typename Key, typename T, std::size_t NodeBytes>
+typename BTreeMap<Key, T, NodeBytes>::size_type
+BTreeMap<Key, T, NodeBytes>::size() const noexcept {
+  return size_;
+}
+
+template <typename Key, typename T, std::size_t NodeBytes>
+typename BTreeMap<Key, T, NodeBytes>::size_type
+BTreeMap<Key, T, NodeBytes>::max_size() const noexcept {
+  return std::numeric_limits<size_type>::max() / (sizeof(Key) + sizeof(T));
+}
+
+template <typename Key, typename T, std::size_t NodeBytes>
+void BTreeMap<Key, T, NodeBytes>::clear() noexcept {
+  if (root_) destroy(root_);
+  root_ = nullptr;
+  first_ = last_ = nullptr;
+  size_ = 0;
+}
+
+template <typename Key, typename T, std::size_t NodeBytes>
+std::pair<typename BTreeMap<Key, T, NodeBytes>::iterator, bool>
+BTreeMap<Key, T, NodeBytes>::insert(const_reference value) {
+  return emplace_key(value.first, value.second, false);
+}
+
+template <typename Key, typename T, std::size_t NodeBytes>
+std::pair<typename BTreeMap<Key, T, NodeBytes>::iterator, bool>
+BTreeMap<Key, T, NodeBytes>::insert(const Key& key, const T& obj) {
+  return emplace_key(key, obj, false);
+}
+
+template <typename Key, typename T, std::size_t NodeBytes>
+std::pair<typename BTreeMap<Key, T, NodeBytes>::iterator, bool>
+BTreeMap<Key, T, NodeBytes>::insert_or_assign(const Key& key, const T& obj) {
+  return emplace_key(key, obj, true);
+}
+
+template <typename Key, typename T, std::size_t NodeBytes>
+template <typename... Args>
+std::vector<std::pair<typename BTreeMap<Key, T, NodeBytes>::iterator, bool>>
+BTreeMap<Key, T, NodeBytes>::insert_many(Args&&... args) {
+  std::vector<std::pair<iterator, bool>> results;
+  (results.push_back(insert(std::forward<Args>(args))), ...);
+  return results;
+}
+
+template <typename Key, typename T, std::size_t NodeBytes>
+void BTreeMap<Key, T, NodeBytes>::erase(iterator pos) {
+  if (!pos.leaf_) return;
+  Path path;
+  // Путь восстанавливается спуском по ключу, копия нужна до удаления
+  const Key key = pos.key();
+  auto [leaf, index] = locate(key, &path);
+  leaf_erase(leaf, index);
+  --size_;
+  if (leaf == root_) {
+    if (leaf->count == 0) clear();
+  } else if (leaf->count < kLeafMin) {
+    rebalance_leaf(path, leaf);
+  }
+}
+
+template <typename Key, typename T, std::size_t NodeBytes>
+void BTreeMap<Key, T, NodeBytes>::swap(BTreeMap& other) noexcept {
+  std::swap(root_, other.root_);
+  std::swap(first_, other.first_);
+  std::swap(last_, other.last_);
+  std::swap(size_, other.size_);
+}
+
+template <typename Key, typename T, std::size_t NodeBytes>
+void BTreeMap<Key, T, NodeBytes>::merge(BTreeMap& other) {
+  // Как s21::Map::merge: пары с отсутствующими здесь ключами копируются,
+  // other не меняется
+  if (this == &other) return;
+  for (auto it = other.begin(); it != other.end(); ++it) {
+    insert(it.key(), it.value());
+  }
+}
+
+template <typename Key, typename T, std::size_t NodeBytes>
+typename BTreeMap<Key, T, NodeBytes>::iterator
+BTreeMap<Key, T, NodeBytes>::find(const Key& key) {
+  auto [leaf, index] = locate(key, nullptr);
+  if (leaf && index < leaf->count && !less(key, leaf->keys()[index])) {
+    return iterator(this, leaf, index);
+  }
+  return end();
+}
+
+template <typename Key, typename T, std::size_t NodeBytes>
+typename BTreeMap<Key, T, NodeBytes>::const_iterator
+BTreeMap<Key, T, NodeBytes>::find(const Key& key) const {
+  auto [leaf, index] = locate(key, nullptr);
+  if (leaf && index < leaf->count && !less(key, leaf->keys()[index])) {
+    return const_iterator(this, leaf, index);
+  }
+  return end();
+}
+
+template <typename Key, typename T, std::size_t NodeBytes>
+bool BTreeMap<Key, T, NodeBytes>::contains(const Key& key) const {
+  return find(key) != end();
+}
+
+template <typename Key, typename T, std::size_t NodeBytes>
+T& BTreeMap<Key, T, NodeBytes>::at(const Key& key) {
+  iterator it = find(key);
+  if (it == end()) {
+    throw std::out_of_range("Key not found in the map.");
+  }
+  return it.value();
+}
+
+template <typename Key, typename T, std::size_t NodeBytes>
+const T& BTreeMap<Key, T, NodeBytes>::at(const Key& key) const {
+  const_iterator it = find(key);
+  if (it == end()) {
+    throw std::out_of_range("Key not found in the map.");
+  }
+  return it.value();
+}
+
+template <typename Key, typename T, std::size_t NodeBytes>
+T& BTreeMap<Key, T, NodeBytes>::operator[](const Key& key) {
+  iterator it = find(key);
+  if (it == end()) it = emplace_key(key, T(), false).first;
+  return it.value();
+}
+
+template <typename Key, typename T, std::size_t NodeBytes>
+std::pair<typename BTreeMap<Key, T, NodeBytes>::Leaf*,
+          typename BTreeMap<Key, T, NodeBytes>::size_type>
+BTreeMap<Key, T, NodeBytes>::locate(const Key& key, Path* path) const {
+  // Во внутреннем узле потомок i содержит ключи из [keys[i-1], keys[i])
+  const std::less<Key> comp;
+  Node* node = root_;
+  if (!node) return {nullptr, 0};
+  if (path) path->depth = 0;
+  while (!node->leaf) {
+    Inner* inner = static_cast<Inner*>(node);
+    Key* keys = inner->keys();
+    const size_type slot =
+        std::upper_bound(keys, keys + inner->count, key, comp) - keys;
+    if (path) {
+      path->nodes[path->depth] = inner;
+      path->slots[path->depth++] = slot;
+    }
+    node = inner->children[slot];
+  }
+  Leaf* leaf = static_cast<Leaf*>(node);
+  Key* keys = leaf->keys();
+  const Key* pos = std::lower_bound(keys, keys + leaf->count, key, comp);
+  return {leaf, static_cast<size_type>(pos - keys)};
+}
+
+template <typename Key, typename T, std::size_t NodeBytes>
+template <typename V>
+std::pair<typename BTreeMap<Key, T, NodeBytes>::iterator, bool>
+BTreeMap<Key, T, NodeBytes>::emplace_key(const Key& key, V&& value,
+                                         bool assign) {
+  if (!root_) {
+    Leaf* leaf = new Leaf;
+    root_ = first_ = last_ = leaf;
+  }
+  Path path;
+  auto [leaf, pos] = locate(key, &path);
+  if (pos < leaf->count && !less(key, leaf->keys()[pos])) {
+    if (assign) leaf->values()[pos] = std::forward<V>(value);
+    return {iterator(this, leaf, pos), false};
+  }
+  ++size_;
+  if (leaf->count < kLeafSlots) {
+    leaf_insert(leaf, pos, key, T(std::forward<V>(value)));
+    return {iterator(this, leaf, pos), true};
+  }
+  auto [target, index] =
+      split_leaf(leaf, pos, key, T(std::forward<V>(value)), path);
+  return {iterator(this, target, index), true};
+}
+
+template <typename Key, typename T, std::size_t NodeBytes>
+std::pair<typename BTreeMap<Key, T, NodeBytes>::Leaf*,
+          typename BTreeMap<Key, T, NodeBytes>::size_type>
+BTreeMap<Key, T, NodeBytes>::split_leaf(Leaf* leaf, size_type pos,
+                                        const Key& key, T&& value,
+                                        Path& path) {
+  Leaf* right = new Leaf;
+  right->prev = leaf;
+  right->next = leaf->next;
+  (leaf->next ? leaf->next->prev : last_) = right;
+  leaf->next = right;
+
+  // Вставка в конец последнего листа — загрузка по возрастанию: левый
+  // лист остаётся полным, иначе лист делится пополам
+  const size_type mid = !right->next && pos == leaf->count ? leaf->count
+                                                           : kLeafSlots / 2;
+  for (size_type i = mid; i < leaf->count; ++i) {
+    leaf_move(leaf, i, right, i - mid);
+  }
+  right->count = leaf->count - mid;
+  leaf->count = mid;
+
+  Leaf* target = leaf;
+  if (pos > mid || (pos == mid && mid == kLeafSlots)) {
+    target = right;
+    pos -= mid;
+  }
+  leaf_insert(target, pos, key, std::move(value));
+  insert_into_parent(path, leaf, right->keys()[0], right);
+  return {target, pos};
+}
+
+template <typename Key, typename T, std::size_t NodeBytes>
+void BTreeMap<Key, T, NodeBytes>::insert_into_parent(Path& path, Node* left,
+                                                     const Key& separator,
+                                                     Node* right) {
+  if (path.depth == 0) {
+    Inner* root = new Inner;
+    new (root->keys()) Key(separator);
+    root->children[0] = left;
+    root->children[1] = right;
+    root->count = 1;
+    root_ = root;
+    return;
+  }
+  --path.depth;
+  Inner* parent = path.nodes[path.depth];
+  const size_type slot = path.slots[path.depth];
+  Key* keys = parent->keys();
+  // Сдвиг вправо на один слот; при полном узле занимается запасной
+  if (parent->count > slot) {
+    new (keys + parent->count) Key(std::move(keys[parent->count - 1]));
+    for (size_type i = parent->count - 1; i > slot; --i) {
+      keys[i] = std::move(keys[i - 1]);
+    }
+    keys[slot] = separator;
+  } else {
+    new (keys + slot) Key(separator);
+  }
+  for (size_type i = parent->count + 1; i > slot + 1; --i) {
+    parent->children[i] = parent->children[i - 1];
+  }
+  parent->children[slot + 1] = right;
+  if (++parent->count <= kInnerSlots) return;
+
+  // Средний ключ уходит наверх, правая половина — в новый узел
+  Inner* sibling = new Inner;
+  const size_type mid = parent->count / 2;
+  for (size_type i = mid + 1; i < parent->count; ++i) {
+    new (sibling->keys() + (i - mid - 1)) Key(std::move(keys[i]));
+    keys[i].~Key();
+  }
+  for (size_type i = mid + 1; i <= parent->count; ++i) {
+    sibling->children[i - mid - 1] = parent->children[i];
+  }
+  sibling->count = parent->count - mid - 1;
+  parent->count = mid;
+  const Key up(std::move(keys[mid]));
+  keys[mid].~Key();
+  insert_into_parent(path, parent, up, sibling);
+}
+
+template <typename Key, typename T, std::size_t NodeBytes>
+void BTreeMap<Key, T, NodeBytes>::rebalance_leaf(Path& path, Leaf* leaf) {
+  Inner* parent = path.nodes[path.depth - 1];
+  const size_type slot = path.slots[path.depth - 1];
+  Leaf* left =
+      slot > 0 ? static_cast<Leaf*>(parent->children[slot - 1]) : nullptr;
+  Leaf* right = slot < parent->count
+                    ? static_cast<Leaf*>(parent->children[slot + 1])
+                    : nullptr;
+
+  if (left && left->count > kLeafMin) {
+    // Последняя пара левого соседа переходит в начало листа
+    for (size_type i = leaf->count; i > 0; --i) {
+      leaf_move(leaf, i - 1, leaf, i);
+    }
+    leaf_move(left, left->count - 1, leaf, 0);
+    --left->count;
+    ++leaf->count;
+    parent->keys()[slot - 1] = leaf->keys()[0];
+    return;
+  }
+  if (right && right->count > kLeafMin) {
+    leaf_move(right, 0, leaf, leaf->count);
+    ++leaf->count;
+    for (size_type i = 1; i < right->count; ++i) {
+      leaf_move(right, i, right, i - 1);
+    }
+    --right->count;
+    parent->keys()[slot] = right->keys()[0];
+    return;
+  }
+
+  // Соседи заполнены минимально: правый из пары сливается в левый
+  size_type key_pos = slot;
+  if (left) {
+    right = leaf;
+    leaf = left;
+    key_pos = slot - 1;
+  }
+  for (size_type i = 0; i < right->count; ++i) {
+    leaf_move(right, i, leaf, leaf->count + i);
+  }
+  leaf->count += right->count;
+  leaf->next = right->next;
+  (right->next ? right->next->prev : last_) = leaf;
+  right->count = 0;
+  delete right;
+  inner_erase(parent, key_pos);
+  rebalance_inner(path, path.depth - 1);
+}
+
+template <typename Key, typename T, std::size_t NodeBytes>
+void BTreeMap<Key, T, NodeBytes>::rebalance_inner(Path& path,
+                                                  size_type level) {
+  Inner* node = path.nodes[level];
+  if (level == 0) {
+    // Корень без ключей заменяется единственным потомком
+    if (node->count == 0) {
+      root_ = node->children[0];
+      delete node;
+    }
+    return;
+  }
+  if (node->count >= kInnerMin) return;
+
+  Inner* parent = path.nodes[level - 1];
+  const size_type slot = path.slots[level - 1];
+  Inner* left =
+      slot > 0 ? static_cast<Inner*>(parent->children[slot - 1]) : nullptr;
+  Inner* right = slot < parent->count
+                     ? static_cast<Inner*>(parent->children[slot + 1])
+                     : nullptr;
+  Key* keys = node->keys();
+
+  if (left && left->count > kInnerMin) {
+    // Разделитель спускается в узел, последний ключ соседа — на его место
+    // В недозаполненном узле есть хотя бы один ключ: деление ровное
+    new (keys + node->count) Key(std::move(keys[node->count - 1]));
+    for (size_type i = node->count - 1; i > 0; --i) {
+      keys[i] = std::move(keys[i - 1]);
+    }
+    keys[0] = std::move(parent->keys()[slot - 1]);
+    for (size_type i = node->count + 1; i > 0; --i) {
+      node->children[i] = node->children[i - 1];
+    }
+    node->children[0] = left->children[left->count];
+    ++node->count;
+    Key* left_keys = left->keys();
+    parent->keys()[slot - 1] = std::move(left_keys[left->count - 1]);
+    left_keys[--left->count].~Key();
+    return;
+  }
+  if (right && right->count > kInnerMin) {
+    Key* right_keys = right->keys();
+    new (keys + node->count) Key(std::move(parent->keys()[slot]));
+    node->children[++node->count] = right->children[0];
+    parent->keys()[slot] = std::move(right_keys[0]);
+    for (size_type i = 1; i < right->count; ++i) {
+      right_keys[i - 1] = std::move(right_keys[i]);
+    }
+    for (size_type i = 1; i <= right->count; ++i) {
+      right->children[i - 1] = right->children[i];
+    }
+    right_keys[--right->count].~Key();
+    return;
+  }
+
+  // Слияние: левый узел + разделитель + правый узел
+  size_type key_pos = slot;
+  if (left) {
+    right = node;
+    node = left;
+    key_pos = slot - 1;
+  }
+  Key* left_keys = node->keys();
+  Key* right_keys = right->keys();
+  new (left_keys + node->count) Key(std::move(parent->keys()[key_pos]));
+  for (size_type i = 0; i < right->count; ++i) {
+    new (left_keys + node->count + 1 + i) Key(std::move(right_keys[i]));
+    right_keys[i].~Key();
+  }
+  for (size_type i = 0; i <= right->count; ++i) {
+    node->children[node->count + 1 + i] = right->children[i];
+  }
+  node->count += right->count + 1;
+  delete right;
+  inner_erase(parent, key_pos);
+  rebalance_inner(path, level - 1);
+}
+
+template <typename Key, typename T, std::size_t NodeBytes>
+void BTreeMap<Key, T, NodeBytes>::leaf_insert(Leaf* leaf, size_type pos,
+                                              const Key& key, T&& value) {
+  for (size_type i = leaf->count; i > pos; --i) {
+    leaf_move(leaf, i - 1, leaf, i);
+  }
+  new (leaf->keys() + pos) Key(key);
+  new (leaf->values() + pos) T(std::move(value));
+  ++leaf->count;
+}
+
+template <typename Key, typename T, std::size_t NodeBytes>
+void BTreeMap<Key, T, NodeBytes>::leaf_move(Leaf* from, size_type i,
+                                            Leaf* to, size_type j) {
+  // Перенос пары в неинициализированный слот с разрушением исходной
+  new (to->keys() + j) Key(std::move(from->keys()[i]));
+  new (to->values() + j) T(std::move(from->values()[i]));
+  from->keys()[i].~Key();
+  from->values()[i].~T();
+}
+
+template <typename Key, typename T, std::size_t NodeBytes>
+void BTreeMap<Key, T, NodeBytes>::leaf_erase(Leaf* leaf, size_type pos) {
+  leaf->keys()[pos].~Key();
+  leaf->values()[pos].~T();
+  for (size_type i = pos + 1; i < leaf->count; ++i) {
+    leaf_move(leaf, i, leaf, i - 1);
+  }
+  --leaf->count;
+}
+
+template <typename Key, typename T, std::size_t NodeBytes>
+void BTreeMap<Key, T, NodeBytes>::inner_erase(Inner* inner,
+                                              size_type key_pos) {
+  // Удаляются ключ key_pos и правый от него потомок
+  Key* keys = inner->keys();
+  for (size_type i = key_pos + 1; i < inner->count; ++i) {
+    keys[i - 1] = std::move(keys[i]);
+  }
+  keys[inner->count - 1].~Key();
+  for (size_type i = key_pos + 2; i <= inner->count; ++i) {
+    inner->children[i - 1] = inner->children[i];
+  }
+  --inner->count;
+}
+
+template <typename Key, typename T, std::size_t NodeBytes>
+void BTreeMap<Key, T, NodeBytes>::destroy(Node* node) noexcept {
+  if (node->leaf) {
+    Leaf* leaf = static_cast<Leaf*>(node);
+    for (size_type i = 0; i < leaf->count; ++i) {
+      leaf->keys()[i].~Key();
+      leaf->values()[i].~T();
+    }
+    delete leaf;
+    return;
+  }
+  Inner* inner = static_cast<Inner*>(node);
+  for (size_type i = 0; i <= inner->count; ++i) destroy(inner->children[i]);
+  for (size_type i = 0; i < inner->count; ++i) inner->keys()[i].~Key();
+  delete inner;
+}
+}  // namespace s21
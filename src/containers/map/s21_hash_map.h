@@ -0,0 +1,329 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "s21_swiss_table.h"
+
+namespace s21 {
+// Неупорядоченный словарь с интерфейсом s21::Map на хеш-таблице с открытой
+// адресацией (SwissTable). Ключ и значение лежат прямо в массиве слотов,
+// без отдельного узла на каждую пару, а поиск обычно укладывается в одну
+// группу управляющих байт и одно сравнение ключей. Порядок обхода не
+// определён. Вставка может перехешировать таблицу и инвалидировать все
+// итераторы; удаление инвалидирует только итератор удалённого элемента.
+// Разыменование итератора даёт std::pair<const Key&, T&>.
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class HashMap {
+ public:  // members
+  template <bool Const>
+  class HashIterator;
+
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using iterator = HashIterator<false>;
+  using const_iterator = HashIterator<true>;
+
+ private:  // slots
+  struct Slot {
+    // Для operator[]: значение создаётся только при настоящей вставке
+    explicit Slot(const Key& k) : key(k), value() {}
+    template <typename K, typename V>
+    Slot(K&& k, V&& v) : key(std::forward<K>(k)), value(std::forward<V>(v)) {}
+
+    Key key;
+    T value;
+  };
+
+  struct KeyOf {
+    const Key& operator()(const Slot& slot) const noexcept {
+      return slot.key;
+    }
+  };
+
+  using Table = SwissTable<Slot, Key, KeyOf, Hash, KeyEqual>;
+
+ private:  // attributes
+  Table table_;
+
+ public:  // constructors
+  HashMap() = default;
+  HashMap(std::initializer_list<value_type> const& items);
+  HashMap(const HashMap& other) = default;
+  HashMap(HashMap&& other) noexcept = default;
+  ~HashMap() = default;
+
+  HashMap& operator=(HashMap&& other) noexcept = default;
+  HashMap& operator=(const HashMap& other) = default;
+
+ public:  // iterators
+  iterator begin() noexcept;
+  iterator end() noexcept;
+  const_iterator begin() const noexcept;
+  const_iterator end() const noexcept;
+  const_iterator cbegin() const noexcept;
+  const_iterator cend() const noexcept;
+
+ public:  // capacity
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type max_size() const noexcept;
+  size_type bucket_count() const noexcept;
+  void reserve(size_type count);
+
+ public:  // modifiers
+  void clear() noexcept;
+  std::pair<iterator, bool> insert(const_reference value);
+  std::pair<iterator, bool> insert(const Key& key, const T& obj);
+  std::pair<iterator, bool> insert_or_assign(const Key& key, const T& obj);
+  template <typename... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args&&... args);
+  void erase(iterator pos);
+  void swap(HashMap& other) noexcept;
+  void merge(HashMap& other);
+
+ public:  // lookup
+  iterator find(const Key& key);
+  const_iterator find(const Key& key) const;
+  bool contains(const Key& key) const;
+  T& at(const Key& key);
+  const T& at(const Key& key) const;
+  T& operator[](const Key& key);
+};
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+template <bool Const>
+class HashMap<Key, T, Hash, KeyEqual>::HashIterator {
+ public:  // members
+  using mapped_reference = std::conditional_t<Const, const T&, T&>;
+  using value_type = std::pair<const Key&, mapped_reference>;
+  using table_pointer = std::conditional_t<Const, const Table*, Table*>;
+
+ public:  // constructors
+  HashIterator() = default;
+  HashIterator(table_pointer table, size_type index)
+      : table_(table), index_(index) {}
+  // Неконстантный итератор приводится к константному
+  template <bool Other, typename = std::enable_if_t<Const && !Other>>
+  HashIterator(const HashIterator<Other>& other)
+      : table_(other.table_), index_(other.index_) {}
+
+ public:  // access
+  value_type operator*() const {
+    return value_type(table_->slot(index_).key, table_->slot(index_).value);
+  }
+  const Key& key() const { return table_->slot(index_).key; }
+  mapped_reference value() const { return table_->slot(index_).value; }
+
+ public:  // movement
+  HashIterator& operator++() {
+    index_ = table_->next_full(index_ + 1);
+    return *this;
+  }
+  HashIterator operator++(int) {
+    HashIterator old = *this;
+    ++*this;
+    return old;
+  }
+
+  bool operator==(const HashIterator& other) const {
+    return index_ == other.index_;
+  }
+  bool operator!=(const HashIterator& other) const {
+    return !(*this == other);
+  }
+
+ private:  // attributes
+  friend class HashMap;
+  template <bool>
+  friend class HashIterator;
+  table_pointer table_ = nullptr;
+  size_type index_ = 0;
+};
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+HashMap<Key, T, Hash, KeyEqual>::HashMap(
+    std::initializer_list<value_type> const& items) {
+  table_.reserve(items.size());
+  for (const auto& item : items) insert(item);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename HashMap<Key, T, Hash, KeyEqual>::iterator
+HashMap<Key, T, Hash, KeyEqual>::begin() noexcept {
+  return iterator(&table_, table_.next_full(0));
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename HashMap<Key, T, Hash, KeyEqual>::iterator
+HashMap<Key, T, Hash, KeyEqual>::end() noexcept {
+  return iterator(&table_, table_.capacity());
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename HashMap<Key, T, Hash, KeyEqual>::const_iterator
+HashMap<Key, T, Hash, KeyEqual>::begin() const noexcept {
+  return const_iterator(&table_, table_.next_full(0));
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename HashMap<Key, T, Hash, KeyEqual>::const_iterator
+HashMap<Key, T, Hash, KeyEqual>::end() const noexcept {
+  return const_iterator(&table_, table_.capacity());
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename HashMap<Key, T, Hash, KeyEqual>::const_iterator
+HashMap<Key, T, Hash, KeyEqual>::cbegin() const noexcept {
+  return begin();
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename HashMap<Key, T, Hash, KeyEqual>::const_iterator
+HashMap<Key, T, Hash, KeyEqual>::cend() const noexcept {
+  return end();
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+bool HashMap<Key, T, Hash, KeyEqual>::empty() const noexcept {
+  return table_.size() == 0;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename HashMap<Key, T, Hash, KeyEqual>::size_type
+HashMap<Key, T, Hash, KeyEqual>::size() const noexcept {
+  return table_.size();
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename HashMap<Key, T, Hash, KeyEqual>::size_type
+HashMap<Key, T, Hash, KeyEqual>::max_size() const noexcept {
+  return table_.max_size();
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename HashMap<Key, T, Hash, KeyEqual>::size_type
+HashMap<Key, T, Hash, KeyEqual>::bucket_count() const noexcept {
+  return table_.capacity();
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void HashMap<Key, T, Hash, KeyEqual>::reserve(size_type count) {
+  table_.reserve(count);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void HashMap<Key, T, Hash, KeyEqual>::clear() noexcept {
+  table_.clear();
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+std::pair<typename HashMap<Key, T, Hash, KeyEqual>::iterator, bool>
+HashMap<Key, T, Hash, KeyEqual>::insert(const_reference value) {
+  return insert(value.first, value.second);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+std::pair<typename HashMap<Key, T, Hash, KeyEqual>::iterator, bool>
+HashMap<Key, T, Hash, KeyEqual>::insert(const Key& key, const T& obj) {
+  auto [index, inserted] = table_.emplace(key, key, obj);
+  return {iterator(&table_, index), inserted};
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+std::pair<typename HashMap<Key, T, Hash, KeyEqual>::iterator, bool>
+HashMap<Key, T, Hash, KeyEqual>::insert_or_assign(const Key& key,
+                                                  const T& obj) {
+  auto [index, inserted] = table_.emplace(key, key, obj);
+  if (!inserted) table_.slot(index).value = obj;
+  return {iterator(&table_, index), inserted};
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+template <typename... Args>
+std::vector<std::pair<typename HashMap<Key, T, Hash, KeyEqual>::iterator, bool>>
+HashMap<Key, T, Hash, KeyEqual>::insert_many(Args&&... args) {
+  std::vector<std::pair<iterator, bool>> results;
+  table_.reserve(size() + sizeof...(Args));
+  (results.push_back(insert(std::forward<Args>(args))), ...);
+  return results;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void HashMap<Key, T, Hash, KeyEqual>::erase(iterator pos) {
+  if (pos.index_ < table_.capacity()) table_.erase_at(pos.index_);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void HashMap<Key, T, Hash, KeyEqual>::swap(HashMap& other) noexcept {
+  table_.swap(other.table_);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void HashMap<Key, T, Hash, KeyEqual>::merge(HashMap& other) {
+  // Как s21::Map::merge: пары с отсутствующими здесь ключами копируются,
+  // значения уже бывших ключей и сам other не меняются
+  if (this == &other) return;
+  const Table& source = other.table_;
+  for (size_type i = source.next_full(0); i < source.capacity();
+       i = source.next_full(i + 1)) {
+    const Slot& slot = source.slot(i);
+    table_.emplace(slot.key, slot.key, slot.value);
+  }
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename HashMap<Key, T, Hash, KeyEqual>::iterator
+HashMap<Key, T, Hash, KeyEqual>::find(const Key& key) {
+  size_type index = table_.find(key);
+  return index == Table::npos ? end() : iterator(&table_, index);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename HashMap<Key, T, Hash, KeyEqual>::const_iterator
+HashMap<Key, T, Hash, KeyEqual>::find(const Key& key) const {
+  size_type index = table_.find(key);
+  return index == Table::npos ? end() : const_iterator(&table_, index);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+bool HashMap<Key, T, Hash, KeyEqual>::contains(const Key& key) const {
+  return table_.find(key) != Table::npos;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+T& HashMap<Key, T, Hash, KeyEqual>::at(const Key& key) {
+  size_type index = table_.find(key);
+  if (index == Table::npos) {
+    throw std::out_of_range("Key not found in the map.");
+  }
+  return table_.slot(index).value;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+const T& HashMap<Key, T, Hash, KeyEqual>::at(const Key& key) const {
+  size_type index = table_.find(key);
+  if (index == Table::npos) {
+    throw std::out_of_range("Key not found in the map.");
+  }
+  return table_.slot(index).value;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+T& HashMap<Key, T, Hash, KeyEqual>::operator[](const Key& key) {
+  return table_.slot(table_.emplace(key, key).first).value;
+}
+
+}  // namespace s21
@@ -151,12 +151,7 @@ void Map<Key, T>::merge(Map& other) {
 
 template <typename Key, typename T>
 bool Map<Key, T>::contains(const Key& key) {
-  for (iterator it = tree_.begin(); it != tree_.end(); ++it) {
-    if ((*it).first == key) {
-      return true;  // Возвращаем итератор на найденный элемент
-    }
-  }
-  return false;  // Если элемент не найден
+  return tree_.contains(key);
 }
 
 template <typename Key, typename T>
@@ -0,0 +1,544 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace s21 {
+// Хеш-таблица с открытой адресацией в духе SwissTable — общее ядро для
+// HashMap и хешированных множеств. Каждому слоту соответствует управляющий
+// байт: пусто, надгробие после удаления или 7 младших бит хеша (H2) для
+// занятого слота. Поиск читает сразу группу из 16 байт и одной командой
+// SSE2 находит кандидатов с тем же H2, так что ключи сравниваются почти
+// только при настоящем совпадении. Старшие биты хеша (H1) задают начальную
+// группу, дальше пробирование идёт по группам с растущим шагом.
+//
+// Slot — то, что хранится в слоте (ключ или пара), KeyOf извлекает из слота
+// ключ. Слоты не перемещаются до перехеширования, поэтому номер слота
+// остаётся действительным при удалении других элементов.
+template <typename Slot, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+class SwissTable {
+ public:  // members
+  using size_type = std::size_t;
+  using ctrl_type = signed char;
+
+  static constexpr size_type kGroupWidth = 16;
+  static constexpr size_type npos = std::numeric_limits<size_type>::max();
+
+ private:  // control bytes
+  // Все свободные состояния отрицательны: знаковый бит отличает их от H2
+  static constexpr ctrl_type kEmpty = -128;
+  static constexpr ctrl_type kDeleted = -2;
+
+  // Шестнадцать управляющих байт, начиная с произвольной позиции. Каждый
+  // метод возвращает битовую маску: бит i отвечает байту i группы
+  class Group {
+   public:
+    explicit Group(const ctrl_type* pos);
+    unsigned match(ctrl_type h2) const;
+    unsigned match_empty() const;
+    unsigned match_empty_or_deleted() const;
+    unsigned match_full() const;
+
+   private:
+#if defined(__SSE2__)
+    __m128i ctrl_;
+#else
+    ctrl_type ctrl_[kGroupWidth];
+#endif
+  };
+
+ private:  // attributes
+  // Перед ctrl_[capacity_] лежат байты слотов, за ним — копия первых
+  // kGroupWidth байт, чтобы группа у конца таблицы читалась без перехода
+  ctrl_type* ctrl_;
+  Slot* slots_;
+  size_type capacity_;
+  size_type size_;
+  // Сколько пустых слотов ещё можно занять до перехеширования
+  size_type growth_left_;
+  Hash hash_;
+  KeyEqual equal_;
+
+ public:  // constructors
+  SwissTable();
+  SwissTable(const SwissTable& other);
+  SwissTable(SwissTable&& other) noexcept;
+  ~SwissTable();
+
+  SwissTable& operator=(const SwissTable& other);
+  SwissTable& operator=(SwissTable&& other) noexcept;
+
+ public:  // capacity
+  size_type size() const noexcept { return size_; }
+  size_type capacity() const noexcept { return capacity_; }
+  size_type max_size() const noexcept;
+
+ public:  // slots
+  Slot& slot(size_type index) noexcept { return slots_[index]; }
+  const Slot& slot(size_type index) const noexcept { return slots_[index]; }
+  // Первый занятый слот с номером не меньше index или capacity()
+  size_type next_full(size_type index) const noexcept;
+
+ public:  // operations
+  size_type find(const Key& key) const;
+  // Создаёт Slot(args...) только если key ещё нет. Возвращает номер слота
+  // и признак вставки; key не читается после создания слота
+  template <typename... Args>
+  std::pair<size_type, bool> emplace(const Key& key, Args&&... args);
+  void erase_at(size_type index) noexcept;
+  void clear() noexcept;
+  // Гарантирует вставку до count элементов без перехеширования
+  void reserve(size_type count);
+  void swap(SwissTable& other) noexcept;
+
+ private:  // helpers
+  static size_type growth_limit(size_type capacity) noexcept {
+    return capacity - capacity / 8;
+  }
+  size_type hash_of(const Key& key) const;
+  size_type find_with_hash(const Key& key, size_type hash) const;
+  size_type find_first_non_full(size_type hash) const noexcept;
+  static size_type find_first_non_full(const ctrl_type* ctrl,
+                                       size_type capacity,
+                                       size_type hash) noexcept;
+  size_type prepare_insert(size_type hash);
+  void set_ctrl(size_type index, ctrl_type value) noexcept;
+  static void set_ctrl(ctrl_type* ctrl, size_type capacity, size_type index,
+                       ctrl_type value) noexcept;
+  void rehash(size_type new_capacity);
+  void release() noexcept;
+  static unsigned lowest_bit(unsigned mask) noexcept {
+    return static_cast<unsigned>(__builtin_ctz(mask));
+  }
+};
+
+template <typename Slot, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+SwissTable<Slot, Key, KeyOf, Hash, KeyEqual>::Group::Group(
+    const ctrl_type* pos) {
+#if defined(__SSE2__)
+  ctrl_ = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pos));
+#else
+  std::memcpy(ctrl_, pos, kGroupWidth);
+#endif
+}
+
+template <typename Slot, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+unsigned SwissTable<Slot, Key, KeyOf, Hash, KeyEqual>::Group::match(
+    ctrl_type h2) const {
+#if defined(__SSE2__)
+  return static_cast<unsigned>(
+      _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_)));
+#else
+  unsigned mask = 0;
+  for (size_type i = 0; i < kGroupWidth; ++i) {
+    if (ctrl_[i] == h2) mask |= 1u << i;
+  }
+  return mask;
+#endif
+}
+
+template <typename Slot, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+unsigned SwissTable<Slot, Key, KeyOf, Hash, KeyEqual>::Group::match_empty()
+    const {
+  return match(kEmpty);
+}
+
+template <typename Slot, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+unsigned SwissTable<Slot, Key, KeyOf, Hash,
+                    KeyEqual>::Group::match_empty_or_deleted() const {
+#if defined(__SSE2__)
+  // Свободные байты отрицательны, movemask собирает как раз знаковые биты
+  return static_cast<unsigned>(_mm_movemask_epi8(ctrl_));
+#else
+  unsigned mask = 0;
+  for (size_type i = 0; i < kGroupWidth; ++i) {
+    if (ctrl_[i] < 0) mask |= 1u << i;
+  }
+  return mask;
+#endif
+}
+
+template <typename Slot, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+unsigned SwissTable<Slot, Key, KeyOf, Hash, KeyEqual>::Group::match_full()
+    const {
+  return ~match_empty_or_deleted() & ((1u << kGroupWidth) - 1);
+}
+
+template <typename Slot, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+SwissTable<Slot, Key, KeyOf, Hash, KeyEqual>::SwissTable()
+    : ctrl_(nullptr),
+      slots_(nullptr),
+      capacity_(0),
+      size_(0),
+      growth_left_(0),
+      hash_(),
+      equal_() {}
+
+template <typename Slot, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+SwissTable<Slot, Key, KeyOf, Hash, KeyEqual>::SwissTable(
+    const SwissTable& other)
+    : SwissTable() {
+  hash_ = other.hash_;
+  equal_ = other.equal_;
+  reserve(other.size_);
+  for (size_type i = other.next_full(0); i < other.capacity_;
+       i = other.next_full(i + 1)) {
+    emplace(KeyOf()(other.slots_[i]), other.slots_[i]);
+  }
+}
+
+template <typename Slot, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+SwissTable<Slot, Key, KeyOf, Hash, KeyEqual>::SwissTable(
+    SwissTable&& other) noexcept
+    : ctrl_(other.ctrl_),
+      slots_(other.slots_),
+      capacity_(other.capacity_),
+      size_(other.size_),
+      growth_left_(other.growth_left_),
+      hash_(std::move(other.hash_)),
+      equal_(std::move(other.equal_)) {
+  other.ctrl_ = nullptr;
+  other.slots_ = nullptr;
+  other.capacity_ = other.size_ = other.growth_left_ = 0;
+}
+
+template <typename Slot, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+SwissTable<Slot, Key, KeyOf, Hash, KeyEqual>::~SwissTable() {
+  release();
+}
+
+template <typename Slot, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+SwissTable<Slot, Key, KeyOf, Hash, KeyEqual>&
+SwissTable<Slot, Key, KeyOf, Hash, KeyEqual>::operator=(
+    const SwissTable& other) {
+  if (this != &other) {
+    SwissTable tmp(other);
+    swap(tmp);
+  }
+  return *this;
+}
+
+template <typename Slot, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+SwissTable<Slot, Key, KeyOf, Hash, KeyEqual>&
+SwissTable<Slot, Key, KeyOf, Hash, KeyEqual>::operator=(
+    SwissTable&& other) noexcept {
+  if (this != &other) {
+    SwissTable tmp(std::move(other));
+    swap(tmp);
+  }
+  return *this;
+}
+
+template <typename Slot, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename SwissTable<Slot, Key, KeyOf, Hash, KeyEqual>::size_type
+SwissTable<Slot, Key, KeyOf, Hash, KeyEqual>::max_size() const noexcept {
+  return std::numeric_limits<size_type>::max() / (sizeof(Slot) + 1) / 2;
+}
+
+template <typename Slot, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename SwissTable<Slot, Key, KeyOf, Hash, KeyEqual>::size_type
+SwissTable<Slot, Key, KeyOf, Hash, KeyEqual>::next_full(
+    size_type index) const noexcept {
+  while (index < capacity_) {
+    unsigned mask = Group(ctrl_ + index).match_full();
+    if (mask) {
+      // Бит за концом таблицы указывает на копию первой группы
+      index += lowest_bit(mask);
+      return index < capacity_ ? index : capacity_;
+    }
+    index += kGroupWidth;
+  }
+  return capacity_;
+}
+
+template <typename Slot, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename SwissTable<Slot, Key, KeyOf, Hash, KeyEqual>::size_type
+SwissTable<Slot, Key, KeyOf, Hash, KeyEqual>::find(const Key& key) const {
+  if (size_ == 0) return npos;
+  return find_with_hash(key, hash_of(key));
+}
+
+template <typename Slot, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+template <typename... Args>
+std::pair<typename SwissTable<Slot, Key, KeyOf, Hash, KeyEqual>::size_type,
+          bool>
+SwissTable<Slot, Key, KeyOf, Hash, KeyEqual>::emplace(const Key& key,
+                                                      Args&&... args) {
+  const size_type hash = hash_of(key);
+  if (size_ != 0) {
+    size_type found = find_with_hash(key, hash);
+    if (found != npos) return {found, false};
+  }
+  size_type index = prepare_insert(hash);
+  ::new (static_cast<void*>(slots_ + index)) Slot(std::forward<Args>(args)...);
+  if (ctrl_[index] == kEmpty) --growth_left_;
+  set_ctrl(index, static_cast<ctrl_type>(hash & 0x7F));
+  ++size_;
+  return {index, true};
+}
+
+template <typename Slot, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+void SwissTable<Slot, Key, KeyOf, Hash, KeyEqual>::erase_at(
+    size_type index) noexcept {
+  slots_[index].~Slot();
+  --size_;
+  // Если любое окно из 16 байт вокруг слота содержит пустой байт, ни один
+  // поиск не проходил мимо этого слота дальше, и надгробие не нужно
+  const size_type mask = capacity_ - 1;
+  unsigned empty_after = Group(ctrl_ + index).match_empty();
+  unsigned empty_before =
+      Group(ctrl_ + ((index - kGroupWidth) & mask)).match_empty();
+  bool was_never_full =
+      empty_before && empty_after &&
+      lowest_bit(empty_after) +
+              (static_cast<unsigned>(__builtin_clz(empty_before)) -
+               (32 - kGroupWidth)) <
+          kGroupWidth;
+  if (was_never_full) {
+    set_ctrl(index, kEmpty);
+    ++growth_left_;
+  } else {
+    set_ctrl(index, kDeleted);
+  }
+}
+
+template <typename Slot, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+void SwissTable<Slot, Key, KeyOf, Hash, KeyEqual>::clear() noexcept {
+  if (capacity_ == 0) return;
+  for (size_type i = next_full(0); i < capacity_; i = next_full(i + 1)) {
+    slots_[i].~Slot();
+  }
+  std::memset(ctrl_, kEmpty, capacity_ + kGroupWidth);
+  size_ = 0;
+  growth_left_ = growth_limit(capacity_);
+}
+
+template <typename Slot, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+void SwissTable<Slot, Key, KeyOf, Hash, KeyEqual>::reserve(size_type count) {
+  if (count == 0) return;
+  // Иначе удвоение ёмкости ниже переполнится и не закончится
+  if (count > max_size()) {
+    throw std::length_error("SwissTable size exceeds max_size");
+  }
+  size_type capacity = kGroupWidth;
+  while (growth_limit(capacity) < count) capacity *= 2;
+  if (capacity > capacity_) {
+    rehash(capacity);
+  } else if (count > size_ + growth_left_) {
+    // Места хватает, но его занимают надгробия: после чистки следующие
+    // count - size() вставок не перехешируют таблицу
+    rehash(capacity_);
+  }
+}
+
+template <typename Slot, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+void SwissTable<Slot, Key, KeyOf, Hash, KeyEqual>::swap(
+    SwissTable& other) noexcept {
+  std::swap(ctrl_, other.ctrl_);
+  std::swap(slots_, other.slots_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(size_, other.size_);
+  std::swap(growth_left_, other.growth_left_);
+  std::swap(hash_, other.hash_);
+  std::swap(equal_, other.equal_);
+}
+
+template <typename Slot, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename SwissTable<Slot, Key, KeyOf, Hash, KeyEqual>::size_type
+SwissTable<Slot, Key, KeyOf, Hash, KeyEqual>::hash_of(const Key& key) const {
+  // std::hash для целых — тождественная функция: перемешиваем биты, чтобы
+  // и H1, и H2 зависели от всего ключа
+  std::uint64_t x = static_cast<std::uint64_t>(hash_(key));
+  x ^= x >> 33;
+  x *= 0xff51afd7ed558ccdULL;
+  x ^= x >> 33;
+  return static_cast<size_type>(x);
+}
+
+template <typename Slot, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename SwissTable<Slot, Key, KeyOf, Hash, KeyEqual>::size_type
+SwissTable<Slot, Key, KeyOf, Hash, KeyEqual>::find_with_hash(
+    const Key& key, size_type hash) const {
+  const size_type mask = capacity_ - 1;
+  const auto h2 = static_cast<ctrl_type>(hash & 0x7F);
+  size_type offset = (hash >> 7) & mask;
+  // Треугольные шаги по группам обходят всю таблицу степени двойки
+  for (size_type step = kGroupWidth;; step += kGroupWidth) {
+    Group group(ctrl_ + offset);
+    for (unsigned bits = group.match(h2); bits; bits &= bits - 1) {
+      size_type index = (offset + lowest_bit(bits)) & mask;
+      if (equal_(KeyOf()(slots_[index]), key)) return index;
+    }
+    if (group.match_empty()) return npos;
+    offset = (offset + step) & mask;
+  }
+}
+
+template <typename Slot, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename SwissTable<Slot, Key, KeyOf, Hash, KeyEqual>::size_type
+SwissTable<Slot, Key, KeyOf, Hash, KeyEqual>::find_first_non_full(
+    size_type hash) const noexcept {
+  return find_first_non_full(ctrl_, capacity_, hash);
+}
+
+template <typename Slot, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename SwissTable<Slot, Key, KeyOf, Hash, KeyEqual>::size_type
+SwissTable<Slot, Key, KeyOf, Hash, KeyEqual>::find_first_non_full(
+    const ctrl_type* ctrl, size_type capacity, size_type hash) noexcept {
+  const size_type mask = capacity - 1;
+  size_type offset = (hash >> 7) & mask;
+  for (size_type step = kGroupWidth;; step += kGroupWidth) {
+    unsigned bits = Group(ctrl + offset).match_empty_or_deleted();
+    if (bits) return (offset + lowest_bit(bits)) & mask;
+    offset = (offset + step) & mask;
+  }
+}
+
+template <typename Slot, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+typename SwissTable<Slot, Key, KeyOf, Hash, KeyEqual>::size_type
+SwissTable<Slot, Key, KeyOf, Hash, KeyEqual>::prepare_insert(size_type hash) {
+  if (capacity_ == 0) {
+    rehash(kGroupWidth);
+    return find_first_non_full(hash);
+  }
+  size_type index = find_first_non_full(hash);
+  if (growth_left_ == 0 && ctrl_[index] != kDeleted) {
+    // Если место съели в основном надгробия, хватит перехеширования на
+    // месте; иначе таблица удваивается
+    rehash(size_ <= growth_limit(capacity_) / 2 ? capacity_ : capacity_ * 2);
+    index = find_first_non_full(hash);
+  }
+  return index;
+}
+
+template <typename Slot, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+void SwissTable<Slot, Key, KeyOf, Hash, KeyEqual>::set_ctrl(
+    size_type index, ctrl_type value) noexcept {
+  set_ctrl(ctrl_, capacity_, index, value);
+}
+
+template <typename Slot, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+void SwissTable<Slot, Key, KeyOf, Hash, KeyEqual>::set_ctrl(
+    ctrl_type* ctrl, size_type capacity, size_type index,
+    ctrl_type value) noexcept {
+  ctrl[index] = value;
+  if (index < kGroupWidth) ctrl[capacity + index] = value;
+}
+
+template <typename Slot, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+void SwissTable<Slot, Key, KeyOf, Hash, KeyEqual>::rehash(
+    size_type new_capacity) {
+  std::allocator<Slot> allocator;
+  Slot* new_slots = allocator.allocate(new_capacity);
+  ctrl_type* new_ctrl;
+  try {
+    new_ctrl = new ctrl_type[new_capacity + kGroupWidth];
+  } catch (...) {
+    allocator.deallocate(new_slots, new_capacity);
+    throw;
+  }
+  std::memset(new_ctrl, kEmpty, new_capacity + kGroupWidth);
+
+  // Слоты переносятся в новые массивы, а члены меняются только в конце:
+  // если хеш или конструктор слота бросит, таблица остаётся прежней. Хеш,
+  // который может бросить, считается для всех ключей до первого переноса,
+  // иначе после исключения пришлось бы возвращать уже перенесённые слоты
+  constexpr bool kNothrowHash =
+      std::is_nothrow_invocable_v<const Hash&, const Key&>;
+  std::unique_ptr<size_type[]> hashes;
+  try {
+    if constexpr (!kNothrowHash) {
+      hashes.reset(new size_type[size_]);
+      for (size_type i = next_full(0), n = 0; i < capacity_;
+           i = next_full(i + 1)) {
+        hashes[n++] = hash_of(KeyOf()(slots_[i]));
+      }
+    }
+    // Новая таблица без надгробий: достаточно первого свободного слота
+    for (size_type i = next_full(0), n = 0; i < capacity_;
+         i = next_full(i + 1), ++n) {
+      size_type hash;
+      if constexpr (kNothrowHash) {
+        hash = hash_of(KeyOf()(slots_[i]));
+      } else {
+        hash = hashes[n];
+      }
+      size_type index = find_first_non_full(new_ctrl, new_capacity, hash);
+      ::new (static_cast<void*>(new_slots + index))
+          Slot(std::move_if_noexcept(slots_[i]));
+      set_ctrl(new_ctrl, new_capacity, index,
+               static_cast<ctrl_type>(hash & 0x7F));
+    }
+  } catch (...) {
+    for (size_type i = 0; i < new_capacity; ++i) {
+      if (new_ctrl[i] >= 0) new_slots[i].~Slot();
+    }
+    delete[] new_ctrl;
+    allocator.deallocate(new_slots, new_capacity);
+    throw;
+  }
+
+  for (size_type i = next_full(0); i < capacity_; i = next_full(i + 1)) {
+    slots_[i].~Slot();
+  }
+  if (capacity_ != 0) {
+    delete[] ctrl_;
+    allocator.deallocate(slots_, capacity_);
+  }
+  ctrl_ = new_ctrl;
+  slots_ = new_slots;
+  capacity_ = new_capacity;
+  growth_left_ = growth_limit(capacity_) - size_;
+}
+
+template <typename Slot, typename Key, typename KeyOf, typename Hash,
+          typename KeyEqual>
+void SwissTable<Slot, Key, KeyOf, Hash, KeyEqual>::release() noexcept {
+  if (capacity_ == 0) return;
+  clear();
+  delete[] ctrl_;
+  std::allocator<Slot>().deallocate(slots_, capacity_);
+  ctrl_ = nullptr;
+  slots_ = nullptr;
+  capacity_ = growth_left_ = 0;
+}
+
+}  // namespace s21
@@ -1,5 +1,6 @@
 #pragma once
 #include <iostream>
+#include <limits>
 #include <vector>
 namespace s21 {
 template <typename T>
@@ -57,12 +58,23 @@ class BinaryTreeMultiset {
   size_type max_size();
   void clear();
 
+  // lookup
+  iterator find(const_reference data);
+  bool contains(const_reference data) const;
+  size_type count(const_reference data) const;
+  iterator lower_bound(const_reference data);
+  iterator upper_bound(const_reference data);
+  std::pair<iterator, iterator> equal_range(const_reference data);
+
   // Вспомогательные функции
  private:
   void delete_tree(Node*& node);
   Node* insert(Node* node, Node* parent_node, const_reference data);
   void replace_node(Node* old_node, Node* new_node);
   Node* find_min(Node* node) const;
+  Node* find_node(const_reference data) const;
+  Node* lower_bound_node(const_reference data) const;
+  Node* upper_bound_node(const_reference data) const;
 
  public:  // iterators
   iterator begin();
@@ -282,6 +294,8 @@ void BinaryTreeMultiset<T>::erase(SetIterator pos) {
     // Копируем данные successor в node_to_remove
     node_to_remove->data_ = successor->data_;
     node_to_remove->count_ = successor->count_;
+    // Дубликаты переехали вместе с данными, сам successor удаляем целиком
+    successor->count_ = 0;
 
     // Удаляем successor (так как у него не может быть более одного ребёнка)
     erase(SetIterator(successor));
@@ -290,6 +304,94 @@ void BinaryTreeMultiset<T>::erase(SetIterator pos) {
   --size_;
 }
 
+template <typename T>
+typename BinaryTreeMultiset<T>::iterator BinaryTreeMultiset<T>::find(
+    const_reference data) {
+  return SetIterator(find_node(data));
+}
+
+template <typename T>
+bool BinaryTreeMultiset<T>::contains(const_reference data) const {
+  return find_node(data) != nullptr;
+}
+
+template <typename T>
+typename BinaryTreeMultiset<T>::size_type BinaryTreeMultiset<T>::count(
+    const_reference data) const {
+  const Node* node = find_node(data);
+  // count_ хранит число дубликатов сверх первого экземпляра
+  return node ? node->count_ + 1 : 0;
+}
+
+template <typename T>
+typename BinaryTreeMultiset<T>::iterator BinaryTreeMultiset<T>::lower_bound(
+    const_reference data) {
+  return SetIterator(lower_bound_node(data));
+}
+
+template <typename T>
+typename BinaryTreeMultiset<T>::iterator BinaryTreeMultiset<T>::upper_bound(
+    const_reference data) {
+  return SetIterator(upper_bound_node(data));
+}
+
+template <typename T>
+std::pair<typename BinaryTreeMultiset<T>::iterator,
+          typename BinaryTreeMultiset<T>::iterator>
+BinaryTreeMultiset<T>::equal_range(const_reference data) {
+  return std::make_pair(lower_bound(data), upper_bound(data));
+}
+
+template <typename T>
+typename BinaryTreeMultiset<T>::Node* BinaryTreeMultiset<T>::find_node(
+    const_reference data) const {
+  Node* node = root_;
+  while (node) {
+    if (data < node->data_) {
+      node = node->left;
+    } else if (data > node->data_) {
+      node = node->right;
+    } else {
+      return node;
+    }
+  }
+  return nullptr;
+}
+
+template <typename T>
+typename BinaryTreeMultiset<T>::Node* BinaryTreeMultiset<T>::lower_bound_node(
+    const_reference data) const {
+  // Первый узел, ключ которого не меньше data
+  Node* result = nullptr;
+  Node* node = root_;
+  while (node) {
+    if (node->data_ < data) {
+      node = node->right;
+    } else {
+      result = node;
+      node = node->left;
+    }
+  }
+  return result;
+}
+
+template <typename T>
+typename BinaryTreeMultiset<T>::Node* BinaryTreeMultiset<T>::upper_bound_node(
+    const_reference data) const {
+  // Первый узел, ключ которого строго больше data
+  Node* result = nullptr;
+  Node* node = root_;
+  while (node) {
+    if (data < node->data_) {
+      result = node;
+      node = node->left;
+    } else {
+      node = node->right;
+    }
+  }
+  return result;
+}
+
 template <typename T>
 typename BinaryTreeMultiset<T>::Node* BinaryTreeMultiset<T>::find_min(
     Node* node) const {
@@ -0,0 +1,301 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+#include "../map/s21_swiss_table.h"
+
+namespace s21 {
+// Неупорядоченное мультимножество с теми же методами, что у s21::Multiset,
+// на хеш-таблице с открытой адресацией (см. SwissTable). Как и узел
+// BinaryTreeMultiset, слот хранит ключ один раз вместе со счётчиком копий:
+// дубликаты не занимают слотов, а count() — один поиск. Итератор проходит
+// каждую копию, erase удаляет одну копию. lower_bound и upper_bound
+// требуют порядка и здесь отсутствуют; equal_range даёт все копии ключа.
+// merge, как у s21::Multiset, копирует сюда все элементы other и не меняет
+// other.
+template <typename Key, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class HashMultiset {
+ public:  // members
+  class HashMultisetIterator;
+
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using iterator = HashMultisetIterator;
+  using const_iterator = HashMultisetIterator;
+
+ private:  // slots
+  struct Slot {
+    template <typename K>
+    Slot(K&& k, size_type n) : key(std::forward<K>(k)), count(n) {}
+
+    Key key;
+    // Число копий, всегда не меньше 1
+    size_type count;
+  };
+
+  struct KeyOf {
+    const Key& operator()(const Slot& slot) const noexcept {
+      return slot.key;
+    }
+  };
+
+  using Table = SwissTable<Slot, Key, KeyOf, Hash, KeyEqual>;
+
+ private:  // attributes
+  Table table_;
+  // Общее число копий; table_.size() — число различных ключей
+  size_type size_ = 0;
+
+ public:  // constructors
+  HashMultiset() = default;
+  HashMultiset(std::initializer_list<value_type> const& items);
+  HashMultiset(const HashMultiset& other) = default;
+  HashMultiset(HashMultiset&& other) noexcept;
+  ~HashMultiset() = default;
+
+  HashMultiset& operator=(HashMultiset&& other) noexcept;
+  HashMultiset& operator=(const HashMultiset& other) = default;
+
+ public:  // iterators
+  iterator begin() const noexcept;
+  iterator end() const noexcept;
+  const_iterator cbegin() const noexcept;
+  const_iterator cend() const noexcept;
+
+ public:  // capacity
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type max_size() const noexcept;
+  size_type bucket_count() const noexcept;
+  void reserve(size_type count);
+
+ public:  // modifiers
+  void clear() noexcept;
+  std::pair<iterator, bool> insert(const_reference value);
+  template <typename... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args&&... args);
+  void erase(iterator pos);
+  void swap(HashMultiset& other) noexcept;
+  void merge(HashMultiset& other);
+
+ public:  // lookup
+  iterator find(const Key& key) const;
+  bool contains(const Key& key) const;
+  std::pair<iterator, iterator> equal_range(const Key& key) const;
+  size_type count(const Key& key) const;
+};
+
+// Позиция — слот и номер копии в нём
+template <typename Key, typename Hash, typename KeyEqual>
+class HashMultiset<Key, Hash, KeyEqual>::HashMultisetIterator {
+ public:  // constructors
+  HashMultisetIterator() = default;
+  HashMultisetIterator(const Table* table, size_type index, size_type copy)
+      : table_(table), index_(index), copy_(copy) {}
+
+ public:  // access
+  const_reference operator*() const { return table_->slot(index_).key; }
+  const Key* operator->() const { return &table_->slot(index_).key; }
+
+ public:  // movement
+  HashMultisetIterator& operator++() {
+    if (++copy_ == table_->slot(index_).count) {
+      index_ = table_->next_full(index_ + 1);
+      copy_ = 0;
+    }
+    return *this;
+  }
+  HashMultisetIterator operator++(int) {
+    HashMultisetIterator old = *this;
+    ++*this;
+    return old;
+  }
+
+  bool operator==(const HashMultisetIterator& other) const {
+    return index_ == other.index_ && copy_ == other.copy_;
+  }
+  bool operator!=(const HashMultisetIterator& other) const {
+    return !(*this == other);
+  }
+
+ private:  // attributes
+  friend class HashMultiset;
+  const Table* table_ = nullptr;
+  size_type index_ = 0;
+  size_type copy_ = 0;
+};
+
+template <typename Key, typename Hash, typename KeyEqual>
+HashMultiset<Key, Hash, KeyEqual>::HashMultiset(
+    std::initializer_list<value_type> const& items) {
+  for (const auto& item : items) insert(item);
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+HashMultiset<Key, Hash, KeyEqual>::HashMultiset(HashMultiset&& other) noexcept
+    : table_(std::move(other.table_)), size_(other.size_) {
+  other.size_ = 0;
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+HashMultiset<Key, Hash, KeyEqual>& HashMultiset<Key, Hash, KeyEqual>::operator=(
+    HashMultiset&& other) noexcept {
+  if (this != &other) {
+    HashMultiset tmp(std::move(other));
+    swap(tmp);
+  }
+  return *this;
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+typename HashMultiset<Key, Hash, KeyEqual>::iterator
+HashMultiset<Key, Hash, KeyEqual>::begin() const noexcept {
+  return iterator(&table_, table_.next_full(0), 0);
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+typename HashMultiset<Key, Hash, KeyEqual>::iterator
+HashMultiset<Key, Hash, KeyEqual>::end() const noexcept {
+  return iterator(&table_, table_.capacity(), 0);
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+typename HashMultiset<Key, Hash, KeyEqual>::const_iterator
+HashMultiset<Key, Hash, KeyEqual>::cbegin() const noexcept {
+  return begin();
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+typename HashMultiset<Key, Hash, KeyEqual>::const_iterator
+HashMultiset<Key, Hash, KeyEqual>::cend() const noexcept {
+  return end();
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+bool HashMultiset<Key, Hash, KeyEqual>::empty() const noexcept {
+  return size_ == 0;
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+typename HashMultiset<Key, Hash, KeyEqual>::size_type
+HashMultiset<Key, Hash, KeyEqual>::size() const noexcept {
+  return size_;
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+typename HashMultiset<Key, Hash, KeyEqual>::size_type
+HashMultiset<Key, Hash, KeyEqual>::max_size() const noexcept {
+  return table_.max_size();
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+typename HashMultiset<Key, Hash, KeyEqual>::size_type
+HashMultiset<Key, Hash, KeyEqual>::bucket_count() const noexcept {
+  return table_.capacity();
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+void HashMultiset<Key, Hash, KeyEqual>::reserve(size_type count) {
+  table_.reserve(count);
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+void HashMultiset<Key, Hash, KeyEqual>::clear() noexcept {
+  table_.clear();
+  size_ = 0;
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+std::pair<typename HashMultiset<Key, Hash, KeyEqual>::iterator, bool>
+HashMultiset<Key, Hash, KeyEqual>::insert(const_reference value) {
+  auto [index, inserted] = table_.emplace(value, value, 1);
+  size_type copies = inserted ? 1 : ++table_.slot(index).count;
+  ++size_;
+  return {iterator(&table_, index, copies - 1), true};
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+template <typename... Args>
+std::vector<
+    std::pair<typename HashMultiset<Key, Hash, KeyEqual>::iterator, bool>>
+HashMultiset<Key, Hash, KeyEqual>::insert_many(Args&&... args) {
+  // Запас места заранее: итераторы из results не инвалидируются
+  std::vector<std::pair<iterator, bool>> results;
+  table_.reserve(table_.size() + sizeof...(Args));
+  (results.push_back(insert(std::forward<Args>(args))), ...);
+  return results;
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+void HashMultiset<Key, Hash, KeyEqual>::erase(iterator pos) {
+  if (pos.index_ >= table_.capacity()) return;
+  Slot& slot = table_.slot(pos.index_);
+  if (slot.count > 1) {
+    --slot.count;
+  } else {
+    table_.erase_at(pos.index_);
+  }
+  --size_;
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+void HashMultiset<Key, Hash, KeyEqual>::swap(HashMultiset& other) noexcept {
+  table_.swap(other.table_);
+  std::swap(size_, other.size_);
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+void HashMultiset<Key, Hash, KeyEqual>::merge(HashMultiset& other) {
+  if (this == &other) return;
+  const Table& source = other.table_;
+  for (size_type i = source.next_full(0); i < source.capacity();
+       i = source.next_full(i + 1)) {
+    const Slot& slot = source.slot(i);
+    auto [index, inserted] = table_.emplace(slot.key, slot.key, slot.count);
+    if (!inserted) table_.slot(index).count += slot.count;
+    // Размер растёт вместе с каждым ключом: если следующий emplace бросит,
+    // мультимножество останется согласованным
+    size_ += slot.count;
+  }
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+typename HashMultiset<Key, Hash, KeyEqual>::iterator
+HashMultiset<Key, Hash, KeyEqual>::find(const Key& key) const {
+  size_type index = table_.find(key);
+  return index == Table::npos ? end() : iterator(&table_, index, 0);
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+bool HashMultiset<Key, Hash, KeyEqual>::contains(const Key& key) const {
+  return table_.find(key) != Table::npos;
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+std::pair<typename HashMultiset<Key, Hash, KeyEqual>::iterator,
+          typename HashMultiset<Key, Hash, KeyEqual>::iterator>
+HashMultiset<Key, Hash, KeyEqual>::equal_range(const Key& key) const {
+  size_type index = table_.find(key);
+  if (index == Table::npos) return {end(), end()};
+  return {iterator(&table_, index, 0),
+          iterator(&table_, table_.next_full(index + 1), 0)};
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+typename HashMultiset<Key, Hash, KeyEqual>::size_type
+HashMultiset<Key, Hash, KeyEqual>::count(const Key& key) const {
+  size_type index = table_.find(key);
+  return index == Table::npos ? 0 : table_.slot(index).count;
+}
+
+}  // namespace s21
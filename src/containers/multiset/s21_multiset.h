@@ -52,6 +52,7 @@ class Multiset {
 
   iterator lower_bound(const Key& key);
   iterator upper_bound(const Key& key);
+  std::pair<iterator, iterator> equal_range(const Key& key);
   size_type count(const Key& key) const;
 };
 
@@ -153,49 +154,33 @@ void Multiset<Key>::merge(Multiset& other) {
 
 template <typename Key>
 typename Multiset<Key>::iterator Multiset<Key>::find(const Key& key) {
-  for (iterator it = tree_.begin(); it != tree_.end(); ++it) {
-    if (*it == key) {
-      return it;  // Возвращаем итератор на найденный элемент
-    }
-  }
-  return tree_.end();  // Если элемент не найден
+  return tree_.find(key);
 }
 
 template <typename Key>
 bool Multiset<Key>::contains(const Key& key) {
-  for (iterator it = tree_.begin(); it != tree_.end(); ++it) {
-    if (*it == key) {
-      return true;  // Возвращаем итератор на найденный элемент
-    }
-  }
-  return false;  // Если элемент не найден
+  return tree_.contains(key);
 }
 
 template <typename Key>
 typename Multiset<Key>::iterator Multiset<Key>::lower_bound(const Key& key) {
-  auto it = tree_.begin();
-  auto end = tree_.end();
-  while (it != end && *it < key) ++it;
-  return it;
+  return tree_.lower_bound(key);
 }
 
 template <typename Key>
 typename Multiset<Key>::iterator Multiset<Key>::upper_bound(const Key& key) {
-  auto it = lower_bound(key);
-  auto end = tree_.end();
-  while (it != end && *it == key) ++it;
-  return it;
+  return tree_.upper_bound(key);
+}
+
+template <typename Key>
+std::pair<typename Multiset<Key>::iterator, typename Multiset<Key>::iterator>
+Multiset<Key>::equal_range(const Key& key) {
+  return tree_.equal_range(key);
 }
 
 template <typename Key>
 typename Multiset<Key>::size_type Multiset<Key>::count(const Key& key) const {
-  const_iterator it = tree_.cbegin();
-  const_iterator end = tree_.cend();
-  size_type count = 0;
-  for (; it != end; ++it) {
-    if (*it == key) ++count;
-  }
-  return count;
+  return tree_.count(key);
 }
 
 }  // namespace s21
\ No newline at end of file
@@ -0,0 +1,225 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+#include "s21_queue.h"
+
+namespace s21 {
+// Блокирующая очередь на s21::Queue под мьютексом. Пакетные операции
+// push_bulk/pop_bulk переносят много элементов за один захват мьютекса.
+// После close() новые элементы не принимаются, а потребители забирают
+// оставшиеся и получают «пусто» только когда очередь закрыта и исчерпана.
+template <typename T>
+class BatchQueue {
+ public:  // members
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = std::size_t;
+
+ public:  // constructors
+  explicit BatchQueue(
+      size_type capacity = std::numeric_limits<size_type>::max());
+  BatchQueue(const BatchQueue&) = delete;
+  BatchQueue& operator=(const BatchQueue&) = delete;
+  ~BatchQueue() = default;
+
+ public:  // producers
+  bool push(const_reference value);
+  bool push(value_type&& value);
+  template <typename InputIt>
+  size_type push_bulk(InputIt first, InputIt last);
+  template <typename Range>
+  size_type push_bulk(Range&& range);
+
+ public:  // consumers
+  bool pop(reference out);
+  bool try_pop(reference out);
+  template <typename OutputIt, typename Rep, typename Period>
+  size_type pop_bulk(OutputIt out, size_type max,
+                     const std::chrono::duration<Rep, Period>& timeout);
+  template <typename OutputIt>
+  size_type pop_bulk(OutputIt out, size_type max);
+
+ public:  // state
+  void close();
+  bool is_closed() const;
+  bool empty() const;
+  size_type size() const;
+  size_type capacity() const noexcept;
+
+ private:  // attributes
+  mutable std::mutex mutex_;
+  std::condition_variable not_empty_;
+  std::condition_variable not_full_;
+  Queue<value_type> queue_;
+  const size_type capacity_;
+  bool closed_ = false;
+
+ private:  // helpers
+  template <typename U>
+  bool push_one(U&& value);
+  template <typename OutputIt>
+  size_type take(std::unique_lock<std::mutex>& lock, OutputIt out,
+                 size_type max);
+};
+
+template <typename T>
+BatchQueue<T>::BatchQueue(size_type capacity) : capacity_(capacity) {}
+
+template <typename T>
+bool BatchQueue<T>::push(const_reference value) {
+  return push_one(value);
+}
+
+template <typename T>
+bool BatchQueue<T>::push(value_type&& value) {
+  return push_one(std::move(value));
+}
+
+template <typename T>
+template <typename U>
+bool BatchQueue<T>::push_one(U&& value) {
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_full_.wait(lock,
+                   [this] { return closed_ || queue_.size() < capacity_; });
+    if (closed_) return false;
+    queue_.push(std::forward<U>(value));
+  }
+  not_empty_.notify_one();
+  return true;
+}
+
+template <typename T>
+template <typename InputIt>
+typename BatchQueue<T>::size_type BatchQueue<T>::push_bulk(InputIt first,
+                                                           InputIt last) {
+  size_type pushed = 0;
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (first != last) {
+    not_full_.wait(lock,
+                   [this] { return closed_ || queue_.size() < capacity_; });
+    if (closed_) break;
+    // За один захват переносится всё, что помещается
+    for (; first != last && queue_.size() < capacity_; ++first, ++pushed) {
+      queue_.push(*first);
+    }
+    if (first != last) {
+      // Очередь заполнена: будим потребителей и ждём места
+      lock.unlock();
+      not_empty_.notify_all();
+      lock.lock();
+    }
+  }
+  lock.unlock();
+  if (pushed) not_empty_.notify_all();
+  return pushed;
+}
+
+template <typename T>
+template <typename Range>
+typename BatchQueue<T>::size_type BatchQueue<T>::push_bulk(Range&& range) {
+  using std::begin;
+  using std::end;
+  // Элементы диапазона-временного перемещаются, иначе копируются
+  if constexpr (std::is_lvalue_reference_v<Range>) {
+    return push_bulk(begin(range), end(range));
+  } else {
+    return push_bulk(std::make_move_iterator(begin(range)),
+                     std::make_move_iterator(end(range)));
+  }
+}
+
+template <typename T>
+bool BatchQueue<T>::pop(reference out) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  not_empty_.wait(lock, [this] { return closed_ || !queue_.empty(); });
+  return take(lock, &out, 1) == 1;
+}
+
+template <typename T>
+bool BatchQueue<T>::try_pop(reference out) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  return take(lock, &out, 1) == 1;
+}
+
+template <typename T>
+template <typename OutputIt, typename Rep, typename Period>
+typename BatchQueue<T>::size_type BatchQueue<T>::pop_bulk(
+    OutputIt out, size_type max,
+    const std::chrono::duration<Rep, Period>& timeout) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  not_empty_.wait_for(lock, timeout,
+                      [this] { return closed_ || !queue_.empty(); });
+  return take(lock, out, max);
+}
+
+template <typename T>
+template <typename OutputIt>
+typename BatchQueue<T>::size_type BatchQueue<T>::pop_bulk(OutputIt out,
+                                                          size_type max) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  not_empty_.wait(lock, [this] { return closed_ || !queue_.empty(); });
+  return take(lock, out, max);
+}
+
+template <typename T>
+template <typename OutputIt>
+typename BatchQueue<T>::size_type BatchQueue<T>::take(
+    std::unique_lock<std::mutex>& lock, OutputIt out, size_type max) {
+  size_type taken = 0;
+  for (; taken < max && !queue_.empty(); ++taken) {
+    *out = std::move(queue_.front());
+    ++out;
+    queue_.pop();
+  }
+  lock.unlock();
+  if (taken > 1) {
+    not_full_.notify_all();
+  } else if (taken == 1) {
+    not_full_.notify_one();
+  }
+  return taken;
+}
+
+template <typename T>
+void BatchQueue<T>::close() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    closed_ = true;
+  }
+  not_empty_.notify_all();
+  not_full_.notify_all();
+}
+
+template <typename T>
+bool BatchQueue<T>::is_closed() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return closed_;
+}
+
+template <typename T>
+bool BatchQueue<T>::empty() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return queue_.empty();
+}
+
+template <typename T>
+typename BatchQueue<T>::size_type BatchQueue<T>::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return queue_.size();
+}
+
+template <typename T>
+typename BatchQueue<T>::size_type BatchQueue<T>::capacity() const noexcept {
+  return capacity_;
+}
+}  // namespace s21
@@ -0,0 +1,209 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+// Ограниченная очередь для многих производителей и многих потребителей без
+// блокировок (схема Вьюкова). У каждого слота свой счётчик sequence:
+// sequence == pos — слот свободен для записи с позиции pos,
+// sequence == pos + 1 — в слоте готовый элемент для чтения с позиции pos.
+// Позиции занимаются compare_exchange, данные публикуются release-записью
+// sequence, поэтому ни одна операция не берёт мьютекс.
+// Занятую позицию нельзя вернуть, поэтому после захвата слота ничего не
+// должно бросать: элемент перемещается в слот и из слота без исключений,
+// а конструирование из прочих аргументов выполняется до захвата.
+template <typename T>
+class MpmcQueue {
+  static_assert(std::is_nothrow_move_constructible_v<T> &&
+                    std::is_nothrow_move_assignable_v<T>,
+                "MpmcQueue needs a nothrow move constructible and move "
+                "assignable T");
+
+ public:  // members
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = std::size_t;
+
+  static constexpr size_type kCacheLine = 64;
+
+ public:  // constructors
+  explicit MpmcQueue(size_type capacity);
+  MpmcQueue(const MpmcQueue&) = delete;
+  MpmcQueue& operator=(const MpmcQueue&) = delete;
+  ~MpmcQueue();
+
+ public:  // modifiers
+  template <typename... Args>
+  bool try_emplace(Args&&... args);
+  bool try_push(const_reference value);
+  bool try_push(value_type&& value);
+  bool try_pop(reference out);
+  void push(const_reference value);
+  void push(value_type&& value);
+  void pop(reference out);
+
+ public:  // capacity
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type capacity() const noexcept;
+
+ private:  // slots
+  struct alignas(kCacheLine) Slot {
+    std::atomic<size_type> sequence;
+    alignas(T) unsigned char storage[sizeof(T)];
+
+    T* item() noexcept { return reinterpret_cast<T*>(storage); }
+  };
+
+ private:  // attributes
+  const size_type mask_;
+  Slot* const slots_;
+  alignas(kCacheLine) std::atomic<size_type> enqueue_pos_{0};
+  alignas(kCacheLine) std::atomic<size_type> dequeue_pos_{0};
+  char padding_[kCacheLine - sizeof(std::atomic<size_type>)];
+
+ private:  // helpers
+  template <typename... Args>
+  bool try_emplace_nothrow(Args&&... args) noexcept;
+  static size_type round_capacity(size_type capacity);
+};
+
+template <typename T>
+MpmcQueue<T>::MpmcQueue(size_type capacity)
+    : mask_(round_capacity(capacity) - 1), slots_(new Slot[mask_ + 1]) {
+  for (size_type i = 0; i <= mask_; ++i) {
+    slots_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+}
+
+template <typename T>
+MpmcQueue<T>::~MpmcQueue() {
+  const size_type tail = enqueue_pos_.load(std::memory_order_relaxed);
+  for (size_type pos = dequeue_pos_.load(std::memory_order_relaxed);
+       pos != tail; ++pos) {
+    slots_[pos & mask_].item()->~T();
+  }
+  delete[] slots_;
+}
+
+template <typename T>
+template <typename... Args>
+bool MpmcQueue<T>::try_emplace(Args&&... args) {
+  if constexpr (std::is_nothrow_constructible_v<T, Args&&...>) {
+    return try_emplace_nothrow(std::forward<Args>(args)...);
+  } else {
+    // Бросающее конструирование выполняется до захвата позиции
+    T value(std::forward<Args>(args)...);
+    return try_emplace_nothrow(std::move(value));
+  }
+}
+
+template <typename T>
+template <typename... Args>
+bool MpmcQueue<T>::try_emplace_nothrow(Args&&... args) noexcept {
+  size_type pos = enqueue_pos_.load(std::memory_order_relaxed);
+  for (;;) {
+    Slot& slot = slots_[pos & mask_];
+    const size_type sequence = slot.sequence.load(std::memory_order_acquire);
+    const auto diff = static_cast<std::ptrdiff_t>(sequence - pos);
+    if (diff == 0) {
+      if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                             std::memory_order_relaxed)) {
+        new (slot.storage) T(std::forward<Args>(args)...);
+        slot.sequence.store(pos + 1, std::memory_order_release);
+        return true;
+      }
+    } else if (diff < 0) {
+      return false;  // слот ещё не прочитан: очередь полна
+    } else {
+      pos = enqueue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+template <typename T>
+bool MpmcQueue<T>::try_push(const_reference value) {
+  return try_emplace(value);
+}
+
+template <typename T>
+bool MpmcQueue<T>::try_push(value_type&& value) {
+  return try_emplace(std::move(value));
+}
+
+template <typename T>
+bool MpmcQueue<T>::try_pop(reference out) {
+  size_type pos = dequeue_pos_.load(std::memory_order_relaxed);
+  for (;;) {
+    Slot& slot = slots_[pos & mask_];
+    const size_type sequence = slot.sequence.load(std::memory_order_acquire);
+    const auto diff = static_cast<std::ptrdiff_t>(sequence - (pos + 1));
+    if (diff == 0) {
+      if (dequeue_pos_.compare_exchange_weak(pos, pos + 1,
+                                             std::memory_order_relaxed)) {
+        out = std::move(*slot.item());
+        slot.item()->~T();
+        // Слот освобождается для записи на следующем круге
+        slot.sequence.store(pos + mask_ + 1, std::memory_order_release);
+        return true;
+      }
+    } else if (diff < 0) {
+      return false;  // элемент ещё не записан: очередь пуста
+    } else {
+      pos = dequeue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+template <typename T>
+void MpmcQueue<T>::push(const_reference value) {
+  // Копия делается один раз, а не на каждой попытке
+  push(value_type(value));
+}
+
+template <typename T>
+void MpmcQueue<T>::push(value_type&& value) {
+  while (!try_emplace(std::move(value))) std::this_thread::yield();
+}
+
+template <typename T>
+void MpmcQueue<T>::pop(reference out) {
+  while (!try_pop(out)) std::this_thread::yield();
+}
+
+template <typename T>
+bool MpmcQueue<T>::empty() const noexcept {
+  return size() == 0;
+}
+
+template <typename T>
+typename MpmcQueue<T>::size_type MpmcQueue<T>::size() const noexcept {
+  // Снимок при одновременных операциях приблизителен
+  const size_type head = dequeue_pos_.load(std::memory_order_acquire);
+  const size_type tail = enqueue_pos_.load(std::memory_order_acquire);
+  return tail > head ? tail - head : 0;
+}
+
+template <typename T>
+typename MpmcQueue<T>::size_type MpmcQueue<T>::capacity() const noexcept {
+  return mask_ + 1;
+}
+
+template <typename T>
+typename MpmcQueue<T>::size_type MpmcQueue<T>::round_capacity(
+    size_type capacity) {
+  if (capacity < 2) {
+    throw std::invalid_argument("MpmcQueue capacity must be at least 2");
+  }
+  size_type rounded = 2;
+  while (rounded < capacity) rounded *= 2;
+  return rounded;
+}
+}  // namespace s21
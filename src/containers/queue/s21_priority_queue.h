@@ -0,0 +1,224 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <utility>
+
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+// Очередь с приоритетом на d-арной куче поверх контейнера с произвольным
+// доступом (operator[], push_back, pop_back). Потомки узла i лежат в
+// [i * Arity + 1, i * Arity + Arity]: большая арность даёт кучу ниже и
+// потомков в одной кэш-линии, но больше сравнений на уровень. Вершина —
+// наибольший элемент по Compare, как у std::priority_queue.
+template <typename T, typename Container = s21::Vector<T>,
+          typename Compare = std::less<typename Container::value_type>,
+          std::size_t Arity = 2>
+class PriorityQueue {
+  static_assert(Arity >= 2, "PriorityQueue arity must be at least 2");
+
+ public:  // members
+  using container_type = Container;
+  using value_compare = Compare;
+  using value_type = typename Container::value_type;
+  using reference = typename Container::reference;
+  using const_reference = typename Container::const_reference;
+  using size_type = typename Container::size_type;
+
+  static constexpr size_type arity = Arity;
+
+ private:  // attributes
+  Container c_;
+  Compare comp_;
+
+ public:  // constructors
+  PriorityQueue() = default;
+  explicit PriorityQueue(const Compare& comp);
+  PriorityQueue(const Compare& comp, Container&& c);
+  PriorityQueue(std::initializer_list<value_type> const& items,
+                const Compare& comp = Compare());
+  template <typename InputIt>
+  PriorityQueue(InputIt first, InputIt last, const Compare& comp = Compare());
+  PriorityQueue(const PriorityQueue& other) = default;
+  PriorityQueue(PriorityQueue&& other) = default;
+  ~PriorityQueue() = default;
+
+  PriorityQueue& operator=(const PriorityQueue& other) = default;
+  PriorityQueue& operator=(PriorityQueue&& other) = default;
+
+ public:  // accessors
+  const_reference top() const;
+
+ public:  // capacity
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+
+ public:  // modifiers
+  void push(const_reference value);
+  void push(value_type&& value);
+  template <typename... Args>
+  void emplace(Args&&... args);
+  void pop();
+  void swap(PriorityQueue& other) noexcept;
+  template <typename... Args>
+  void insert_many_back(Args&&... args);
+
+ private:  // heap
+  void heapify();
+  void sift_up(size_type pos);
+  void sift_down(size_type pos);
+};
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+PriorityQueue<T, Container, Compare, Arity>::PriorityQueue(
+    const Compare& comp)
+    : c_(), comp_(comp) {}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+PriorityQueue<T, Container, Compare, Arity>::PriorityQueue(
+    const Compare& comp, Container&& c)
+    : c_(std::move(c)), comp_(comp) {
+  heapify();
+}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+PriorityQueue<T, Container, Compare, Arity>::PriorityQueue(
+    std::initializer_list<value_type> const& items, const Compare& comp)
+    : PriorityQueue(items.begin(), items.end(), comp) {}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+template <typename InputIt>
+PriorityQueue<T, Container, Compare, Arity>::PriorityQueue(
+    InputIt first, InputIt last, const Compare& comp)
+    : c_(), comp_(comp) {
+  for (; first != last; ++first) c_.push_back(*first);
+  heapify();
+}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+typename PriorityQueue<T, Container, Compare, Arity>::const_reference
+PriorityQueue<T, Container, Compare, Arity>::top() const {
+  return c_.front();
+}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+bool PriorityQueue<T, Container, Compare, Arity>::empty() const noexcept {
+  return c_.empty();
+}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+typename PriorityQueue<T, Container, Compare, Arity>::size_type
+PriorityQueue<T, Container, Compare, Arity>::size() const noexcept {
+  return c_.size();
+}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+void PriorityQueue<T, Container, Compare, Arity>::push(
+    const_reference value) {
+  c_.push_back(value);
+  sift_up(c_.size() - 1);
+}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+void PriorityQueue<T, Container, Compare, Arity>::push(value_type&& value) {
+  c_.push_back(std::move(value));
+  sift_up(c_.size() - 1);
+}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+template <typename... Args>
+void PriorityQueue<T, Container, Compare, Arity>::emplace(Args&&... args) {
+  c_.emplace_back(std::forward<Args>(args)...);
+  sift_up(c_.size() - 1);
+}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+void PriorityQueue<T, Container, Compare, Arity>::pop() {
+  if (c_.empty()) return;
+  const size_type n = c_.size() - 1;
+  if (n == 0) {
+    c_.pop_back();
+    return;
+  }
+  // Дырка от вершины спускается до листа по лучшим потомкам без сравнения
+  // с последним элементом, затем он встаёт в дырку и всплывает: последний
+  // элемент почти всегда мал, поэтому так выходит меньше сравнений
+  size_type pos = 0;
+  for (size_type first = 1; first < n; first = pos * Arity + 1) {
+    const size_type last = first + Arity < n ? first + Arity : n;
+    size_type best = first;
+    for (size_type child = first + 1; child < last; ++child) {
+      if (comp_(c_[best], c_[child])) best = child;
+    }
+    c_[pos] = std::move(c_[best]);
+    pos = best;
+  }
+  c_[pos] = std::move(c_[n]);
+  c_.pop_back();
+  sift_up(pos);
+}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+void PriorityQueue<T, Container, Compare, Arity>::swap(
+    PriorityQueue& other) noexcept {
+  using std::swap;
+  swap(c_, other.c_);
+  swap(comp_, other.comp_);
+}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+template <typename... Args>
+void PriorityQueue<T, Container, Compare, Arity>::insert_many_back(
+    Args&&... args) {
+  const size_type old_size = c_.size();
+  (c_.push_back(std::forward<Args>(args)), ...);
+  // Крупную пачку дешевле перестроить целиком за O(n)
+  if (sizeof...(args) > old_size) {
+    heapify();
+  } else {
+    for (size_type i = old_size; i < c_.size(); ++i) sift_up(i);
+  }
+}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+void PriorityQueue<T, Container, Compare, Arity>::heapify() {
+  // Просеивание снизу вверх от последнего внутреннего узла: O(n)
+  const size_type n = c_.size();
+  if (n < 2) return;
+  for (size_type pos = (n - 2) / Arity + 1; pos-- > 0;) sift_down(pos);
+}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+void PriorityQueue<T, Container, Compare, Arity>::sift_up(size_type pos) {
+  // Элемент поднимается «дыркой»: родители сдвигаются вниз без обменов
+  value_type value = std::move(c_[pos]);
+  while (pos > 0) {
+    const size_type parent = (pos - 1) / Arity;
+    if (!comp_(c_[parent], value)) break;
+    c_[pos] = std::move(c_[parent]);
+    pos = parent;
+  }
+  c_[pos] = std::move(value);
+}
+
+template <typename T, typename Container, typename Compare, std::size_t Arity>
+void PriorityQueue<T, Container, Compare, Arity>::sift_down(size_type pos) {
+  const size_type n = c_.size();
+  value_type value = std::move(c_[pos]);
+  for (;;) {
+    const size_type first = pos * Arity + 1;
+    if (first >= n) break;
+    const size_type last = first + Arity < n ? first + Arity : n;
+    size_type best = first;
+    for (size_type child = first + 1; child < last; ++child) {
+      if (comp_(c_[best], c_[child])) best = child;
+    }
+    if (!comp_(value, c_[best])) break;
+    c_[pos] = std::move(c_[best]);
+    pos = best;
+  }
+  c_[pos] = std::move(value);
+}
+}  // namespace s21
@@ -3,10 +3,12 @@
 
 #include <utility>
 
-#include "../list/s21_list.h"
+#include "s21_ring_buffer.h"
 
 namespace s21 {
-template <typename T, typename Container = s21::List<T>>
+// Контейнер по умолчанию — кольцевой буфер; подходит любой контейнер с
+// push_back/pop_front/front/back/size, например s21::List.
+template <typename T, typename Container = s21::RingBuffer<T>>
 class Queue {
  public:
   using value_type = typename Container::value_type;
@@ -35,6 +37,7 @@ class Queue {
   size_type size() const noexcept;
 
   void push(const_reference value);
+  void push(value_type &&value);
   void pop();
   void swap(Queue &other) noexcept;
 
@@ -105,6 +108,12 @@ void Queue<T, Container>::push(const_reference value) {
   c_.push_back(value);
 }
 
+template <typename T, typename Container>
+void Queue<T, Container>::push(value_type &&value) {
+  // Для контейнеров без push_back(T&&) выбирается копирующая перегрузка
+  c_.push_back(std::move(value));
+}
+
 template <typename T, typename Container>
 void Queue<T, Container>::pop() {
   c_.pop_front();
@@ -118,7 +127,7 @@ void Queue<T, Container>::swap(Queue &other) noexcept {
 template <typename T, typename Container>
 template <typename... Args>
 void Queue<T, Container>::insert_many_back(Args &&...args) {
-  c_.insert_many(c_.cend(), args...);
+  c_.insert_many_back(std::forward<Args>(args)...);
 }
 }  // namespace s21
 
@@ -0,0 +1,327 @@
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace s21 {
+// Кольцевой буфер с ёмкостью-степенью двойки. Элементы лежат в одном
+// непрерывном блоке, индекс берётся по маске, push_back/pop_front не
+// выделяют память, пока хватает ёмкости; при заполнении ёмкость удваивается.
+template <typename T>
+class RingBuffer {
+ public:  // members
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = std::size_t;
+
+ private:  // attributes
+  value_type* data_;
+  size_type capacity_;  // ноль или степень двойки
+  size_type head_;      // индекс первого элемента
+  size_type size_;
+
+ public:  // constructors
+  RingBuffer();
+  RingBuffer(std::initializer_list<value_type> const& items);
+  RingBuffer(const RingBuffer& other);
+  RingBuffer(RingBuffer&& other) noexcept;
+  ~RingBuffer();
+
+  RingBuffer& operator=(RingBuffer&& other) noexcept;
+  RingBuffer& operator=(const RingBuffer& other);
+
+ public:  // accessors
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference front();
+  const_reference front() const;
+  reference back();
+  const_reference back() const;
+
+ public:  // capacity
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type max_size() const noexcept;
+  size_type capacity() const noexcept;
+  void reserve(size_type new_cap);
+
+ public:  // modifiers
+  void clear() noexcept;
+  void push_back(const_reference value);
+  void push_back(value_type&& value);
+  template <typename... Args>
+  reference emplace_back(Args&&... args);
+  template <typename... Args>
+  void insert_many_back(Args&&... args);
+  void pop_front();
+  void pop_back();
+  void swap(RingBuffer& other) noexcept;
+
+ private:  // raw storage
+  size_type slot(size_type pos) const noexcept;
+  size_type grown_capacity(size_type new_cap) const;
+  void reallocate(size_type new_cap);
+  void relocate(value_type* new_data, size_type new_cap);
+};
+
+template <typename T>
+RingBuffer<T>::RingBuffer()
+    : data_(nullptr), capacity_(0), head_(0), size_(0) {}
+
+template <typename T>
+RingBuffer<T>::RingBuffer(std::initializer_list<value_type> const& items)
+    : RingBuffer() {
+  reserve(items.size());
+  for (const auto& item : items) push_back(item);
+}
+
+template <typename T>
+RingBuffer<T>::RingBuffer(const RingBuffer& other) : RingBuffer() {
+  reserve(other.size_);
+  for (size_type i = 0; i < other.size_; ++i) push_back(other[i]);
+}
+
+template <typename T>
+RingBuffer<T>::RingBuffer(RingBuffer&& other) noexcept
+    : data_(other.data_),
+      capacity_(other.capacity_),
+      head_(other.head_),
+      size_(other.size_) {
+  other.data_ = nullptr;
+  other.capacity_ = other.head_ = other.size_ = 0;
+}
+
+template <typename T>
+RingBuffer<T>::~RingBuffer() {
+  clear();
+  ::operator delete(data_);
+}
+
+template <typename T>
+RingBuffer<T>& RingBuffer<T>::operator=(RingBuffer&& other) noexcept {
+  if (this != &other) {
+    RingBuffer tmp(std::move(other));
+    swap(tmp);
+  }
+  return *this;
+}
+
+template <typename T>
+RingBuffer<T>& RingBuffer<T>::operator=(const RingBuffer& other) {
+  if (this != &other) {
+    RingBuffer tmp(other);
+    swap(tmp);
+  }
+  return *this;
+}
+
+template <typename T>
+typename RingBuffer<T>::reference RingBuffer<T>::operator[](size_type pos) {
+  return data_[slot(pos)];
+}
+
+template <typename T>
+typename RingBuffer<T>::const_reference RingBuffer<T>::operator[](
+    size_type pos) const {
+  return data_[slot(pos)];
+}
+
+template <typename T>
+typename RingBuffer<T>::reference RingBuffer<T>::at(size_type pos) {
+  if (pos >= size_) {
+    throw std::out_of_range("Index out of range");
+  }
+  return data_[slot(pos)];
+}
+
+template <typename T>
+typename RingBuffer<T>::const_reference RingBuffer<T>::at(
+    size_type pos) const {
+  if (pos >= size_) {
+    throw std::out_of_range("Index out of range");
+  }
+  return data_[slot(pos)];
+}
+
+template <typename T>
+typename RingBuffer<T>::reference RingBuffer<T>::front() {
+  return data_[head_];
+}
+
+template <typename T>
+typename RingBuffer<T>::const_reference RingBuffer<T>::front() const {
+  return data_[head_];
+}
+
+template <typename T>
+typename RingBuffer<T>::reference RingBuffer<T>::back() {
+  return data_[slot(size_ - 1)];
+}
+
+template <typename T>
+typename RingBuffer<T>::const_reference RingBuffer<T>::back() const {
+  return data_[slot(size_ - 1)];
+}
+
+template <typename T>
+bool RingBuffer<T>::empty() const noexcept {
+  return size_ == 0;
+}
+
+template <typename T>
+typename RingBuffer<T>::size_type RingBuffer<T>::size() const noexcept {
+  return size_;
+}
+
+template <typename T>
+typename RingBuffer<T>::size_type RingBuffer<T>::max_size() const noexcept {
+  return std::numeric_limits<std::size_t>::max() / sizeof(value_type) / 2;
+}
+
+template <typename T>
+typename RingBuffer<T>::size_type RingBuffer<T>::capacity() const noexcept {
+  return capacity_;
+}
+
+template <typename T>
+void RingBuffer<T>::reserve(size_type new_cap) {
+  if (new_cap <= capacity_) return;
+  reallocate(grown_capacity(new_cap));
+}
+
+template <typename T>
+void RingBuffer<T>::clear() noexcept {
+  for (size_type i = 0; i < size_; ++i) data_[slot(i)].~value_type();
+  head_ = size_ = 0;
+}
+
+template <typename T>
+void RingBuffer<T>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T>
+void RingBuffer<T>::push_back(value_type&& value) {
+  emplace_back(std::move(value));
+}
+
+template <typename T>
+template <typename... Args>
+typename RingBuffer<T>::reference RingBuffer<T>::emplace_back(
+    Args&&... args) {
+  if (size_ == capacity_) {
+    // Значение строится до роста: аргументы могут ссылаться на элементы
+    value_type value(std::forward<Args>(args)...);
+    reserve(size_ + 1);
+    new (data_ + slot(size_)) value_type(std::move(value));
+  } else {
+    new (data_ + slot(size_)) value_type(std::forward<Args>(args)...);
+  }
+  return data_[slot(size_++)];
+}
+
+template <typename T>
+template <typename... Args>
+void RingBuffer<T>::insert_many_back(Args&&... args) {
+  constexpr size_type count = sizeof...(args);
+  if (size_ + count <= capacity_) {
+    (push_back(std::forward<Args>(args)), ...);
+    return;
+  }
+  // Аргументы могут ссылаться на элементы, поэтому они строятся в новом
+  // блоке до переноса старых элементов
+  size_type new_cap = grown_capacity(size_ + count);
+  value_type* new_data =
+      static_cast<value_type*>(::operator new(new_cap * sizeof(value_type)));
+  value_type* tail = new_data + size_;
+  size_type built = 0;
+  try {
+    ((new (tail + built) value_type(std::forward<Args>(args)), ++built), ...);
+    relocate(new_data, new_cap);
+  } catch (...) {
+    for (size_type i = 0; i < built; ++i) tail[i].~value_type();
+    ::operator delete(new_data);
+    throw;
+  }
+  size_ += count;
+}
+
+template <typename T>
+void RingBuffer<T>::pop_front() {
+  if (size_ == 0) return;
+  data_[head_].~value_type();
+  head_ = (head_ + 1) & (capacity_ - 1);
+  --size_;
+}
+
+template <typename T>
+void RingBuffer<T>::pop_back() {
+  if (size_ == 0) return;
+  data_[slot(--size_)].~value_type();
+}
+
+template <typename T>
+void RingBuffer<T>::swap(RingBuffer& other) noexcept {
+  std::swap(data_, other.data_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(head_, other.head_);
+  std::swap(size_, other.size_);
+}
+
+template <typename T>
+typename RingBuffer<T>::size_type RingBuffer<T>::slot(
+    size_type pos) const noexcept {
+  return (head_ + pos) & (capacity_ - 1);
+}
+
+template <typename T>
+typename RingBuffer<T>::size_type RingBuffer<T>::grown_capacity(
+    size_type new_cap) const {
+  if (new_cap > max_size()) {
+    throw std::length_error("RingBuffer capacity exceeds max_size");
+  }
+  size_type cap = capacity_ ? capacity_ : 1;
+  while (cap < new_cap) cap *= 2;
+  return cap;
+}
+
+template <typename T>
+void RingBuffer<T>::reallocate(size_type new_cap) {
+  value_type* new_data =
+      static_cast<value_type*>(::operator new(new_cap * sizeof(value_type)));
+  try {
+    relocate(new_data, new_cap);
+  } catch (...) {
+    ::operator delete(new_data);
+    throw;
+  }
+}
+
+template <typename T>
+void RingBuffer<T>::relocate(value_type* new_data, size_type new_cap) {
+  // Элементы переносятся в new_data по порядку, начиная с нулевого слота.
+  // При исключении буфер не меняется, new_data освобождает вызывающий
+  size_type moved = 0;
+  try {
+    for (; moved < size_; ++moved) {
+      new (new_data + moved)
+          value_type(std::move_if_noexcept(data_[slot(moved)]));
+    }
+  } catch (...) {
+    for (size_type i = 0; i < moved; ++i) new_data[i].~value_type();
+    throw;
+  }
+  for (size_type i = 0; i < size_; ++i) data_[slot(i)].~value_type();
+  ::operator delete(data_);
+  data_ = new_data;
+  capacity_ = new_cap;
+  head_ = 0;
+}
+}  // namespace s21
@@ -0,0 +1,170 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace s21 {
+// Ограниченная очередь для одного производителя и одного потребителя без
+// блокировок. Индексы head_ (читает потребитель) и tail_ (пишет
+// производитель) лежат в разных кэш-линиях; каждая сторона кэширует индекс
+// другой и перечитывает атомик только когда кэш говорит «пусто»/«полно».
+// push/try_push вызывает только поток-производитель, front/pop/try_pop —
+// только поток-потребитель.
+template <typename T>
+class SpscQueue {
+ public:  // members
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = std::size_t;
+
+  static constexpr size_type kCacheLine = 64;
+
+ public:  // constructors
+  explicit SpscQueue(size_type capacity);
+  SpscQueue(const SpscQueue&) = delete;
+  SpscQueue& operator=(const SpscQueue&) = delete;
+  ~SpscQueue();
+
+ public:  // producer
+  template <typename... Args>
+  bool try_emplace(Args&&... args);
+  bool try_push(const_reference value);
+  bool try_push(value_type&& value);
+  void push(const_reference value);
+  void push(value_type&& value);
+
+ public:  // consumer
+  T* front() noexcept;
+  void pop() noexcept;
+  bool try_pop(reference out);
+
+ public:  // capacity
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type capacity() const noexcept;
+
+ private:  // attributes
+  const size_type mask_;
+  T* const slots_;
+
+  // Сторона потребителя
+  alignas(kCacheLine) std::atomic<size_type> head_{0};
+  size_type tail_cache_ = 0;
+
+  // Сторона производителя
+  alignas(kCacheLine) std::atomic<size_type> tail_{0};
+  size_type head_cache_ = 0;
+
+  // Хвост объекта не делит линию с соседними данными
+  char padding_[kCacheLine - sizeof(std::atomic<size_type>) -
+                sizeof(size_type)];
+
+ private:  // helpers
+  static size_type round_capacity(size_type capacity);
+};
+
+template <typename T>
+SpscQueue<T>::SpscQueue(size_type capacity)
+    : mask_(round_capacity(capacity) - 1),
+      slots_(static_cast<T*>(::operator new((mask_ + 1) * sizeof(T)))) {}
+
+template <typename T>
+SpscQueue<T>::~SpscQueue() {
+  while (front()) pop();
+  ::operator delete(slots_);
+}
+
+template <typename T>
+template <typename... Args>
+bool SpscQueue<T>::try_emplace(Args&&... args) {
+  const size_type tail = tail_.load(std::memory_order_relaxed);
+  if (tail - head_cache_ > mask_) {
+    head_cache_ = head_.load(std::memory_order_acquire);
+    if (tail - head_cache_ > mask_) return false;
+  }
+  new (slots_ + (tail & mask_)) T(std::forward<Args>(args)...);
+  tail_.store(tail + 1, std::memory_order_release);
+  return true;
+}
+
+template <typename T>
+bool SpscQueue<T>::try_push(const_reference value) {
+  return try_emplace(value);
+}
+
+template <typename T>
+bool SpscQueue<T>::try_push(value_type&& value) {
+  return try_emplace(std::move(value));
+}
+
+template <typename T>
+void SpscQueue<T>::push(const_reference value) {
+  while (!try_emplace(value)) std::this_thread::yield();
+}
+
+template <typename T>
+void SpscQueue<T>::push(value_type&& value) {
+  while (!try_emplace(std::move(value))) std::this_thread::yield();
+}
+
+template <typename T>
+T* SpscQueue<T>::front() noexcept {
+  const size_type head = head_.load(std::memory_order_relaxed);
+  if (head == tail_cache_) {
+    tail_cache_ = tail_.load(std::memory_order_acquire);
+    if (head == tail_cache_) return nullptr;
+  }
+  return slots_ + (head & mask_);
+}
+
+template <typename T>
+void SpscQueue<T>::pop() noexcept {
+  // Вызывается только после front() != nullptr
+  const size_type head = head_.load(std::memory_order_relaxed);
+  slots_[head & mask_].~T();
+  head_.store(head + 1, std::memory_order_release);
+}
+
+template <typename T>
+bool SpscQueue<T>::try_pop(reference out) {
+  T* item = front();
+  if (!item) return false;
+  out = std::move(*item);
+  pop();
+  return true;
+}
+
+template <typename T>
+bool SpscQueue<T>::empty() const noexcept {
+  return size() == 0;
+}
+
+template <typename T>
+typename SpscQueue<T>::size_type SpscQueue<T>::size() const noexcept {
+  // Из третьего потока значение только приблизительное
+  const size_type head = head_.load(std::memory_order_acquire);
+  const size_type tail = tail_.load(std::memory_order_acquire);
+  return tail - head;
+}
+
+template <typename T>
+typename SpscQueue<T>::size_type SpscQueue<T>::capacity() const noexcept {
+  return mask_ + 1;
+}
+
+template <typename T>
+typename SpscQueue<T>::size_type SpscQueue<T>::round_capacity(
+    size_type capacity) {
+  if (capacity == 0) {
+    throw std::invalid_argument("SpscQueue capacity must be positive");
+  }
+  size_type rounded = 1;
+  while (rounded < capacity) rounded *= 2;
+  return rounded;
+}
+}  // namespace s21
@@ -1,4 +1,18 @@
 #pragma once
 
 #include "array/s21_array.h"
-#include "multiset/s21_multiset.h"
\ No newline at end of file
+#include "deque/s21_thread_pool.h"
+#include "deque/s21_work_stealing_deque.h"
+#include "list/s21_intrusive_list.h"
+#include "list/s21_unrolled_list.h"
+#include "map/s21_btree_map.h"
+#include "map/s21_hash_map.h"
+#include "multiset/s21_hash_multiset.h"
+#include "multiset/s21_multiset.h"
+#include "queue/s21_batch_queue.h"
+#include "queue/s21_mpmc_queue.h"
+#include "queue/s21_priority_queue.h"
+#include "queue/s21_spsc_queue.h"
+#include "set/s21_hash_set.h"
+#include "stack/s21_concurrent_stack.h"
+#include "vector/s21_small_vector.h"
\ No newline at end of file
@@ -0,0 +1,232 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+#include "../map/s21_swiss_table.h"
+
+namespace s21 {
+// Неупорядоченное множество с теми же методами, что у s21::Set, на
+// хеш-таблице с открытой адресацией (см. SwissTable). Ключи лежат прямо в
+// массиве слотов. Порядок обхода не определён. Вставка может перехешировать
+// таблицу и инвалидировать все итераторы; удаление инвалидирует только
+// итератор удалённого элемента. merge, как у s21::Set, копирует сюда
+// отсутствующие здесь ключи other и не меняет other.
+template <typename Key, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class HashSet {
+ public:  // members
+  class HashSetIterator;
+
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using iterator = HashSetIterator;
+  using const_iterator = HashSetIterator;
+
+ private:  // slots
+  struct KeyOf {
+    const Key& operator()(const Key& slot) const noexcept { return slot; }
+  };
+
+  using Table = SwissTable<Key, Key, KeyOf, Hash, KeyEqual>;
+
+ private:  // attributes
+  Table table_;
+
+ public:  // constructors
+  HashSet() = default;
+  HashSet(std::initializer_list<value_type> const& items);
+  HashSet(const HashSet& other) = default;
+  HashSet(HashSet&& other) noexcept = default;
+  ~HashSet() = default;
+
+  HashSet& operator=(HashSet&& other) noexcept = default;
+  HashSet& operator=(const HashSet& other) = default;
+
+ public:  // iterators
+  iterator begin() const noexcept;
+  iterator end() const noexcept;
+  const_iterator cbegin() const noexcept;
+  const_iterator cend() const noexcept;
+
+ public:  // capacity
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type max_size() const noexcept;
+  size_type bucket_count() const noexcept;
+  void reserve(size_type count);
+
+ public:  // modifiers
+  void clear() noexcept;
+  std::pair<iterator, bool> insert(const_reference value);
+  template <typename... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args&&... args);
+  void erase(iterator pos);
+  void swap(HashSet& other) noexcept;
+  void merge(HashSet& other);
+
+ public:  // lookup
+  iterator find(const Key& key) const;
+  bool contains(const Key& key) const;
+};
+
+// Ключи менять нельзя, поэтому обычный и константный итераторы совпадают
+template <typename Key, typename Hash, typename KeyEqual>
+class HashSet<Key, Hash, KeyEqual>::HashSetIterator {
+ public:  // constructors
+  HashSetIterator() = default;
+  HashSetIterator(const Table* table, size_type index)
+      : table_(table), index_(index) {}
+
+ public:  // access
+  const_reference operator*() const { return table_->slot(index_); }
+  const Key* operator->() const { return &table_->slot(index_); }
+
+ public:  // movement
+  HashSetIterator& operator++() {
+    index_ = table_->next_full(index_ + 1);
+    return *this;
+  }
+  HashSetIterator operator++(int) {
+    HashSetIterator old = *this;
+    ++*this;
+    return old;
+  }
+
+  bool operator==(const HashSetIterator& other) const {
+    return index_ == other.index_;
+  }
+  bool operator!=(const HashSetIterator& other) const {
+    return !(*this == other);
+  }
+
+ private:  // attributes
+  friend class HashSet;
+  const Table* table_ = nullptr;
+  size_type index_ = 0;
+};
+
+template <typename Key, typename Hash, typename KeyEqual>
+HashSet<Key, Hash, KeyEqual>::HashSet(
+    std::initializer_list<value_type> const& items) {
+  table_.reserve(items.size());
+  for (const auto& item : items) insert(item);
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+typename HashSet<Key, Hash, KeyEqual>::iterator
+HashSet<Key, Hash, KeyEqual>::begin() const noexcept {
+  return iterator(&table_, table_.next_full(0));
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+typename HashSet<Key, Hash, KeyEqual>::iterator
+HashSet<Key, Hash, KeyEqual>::end() const noexcept {
+  return iterator(&table_, table_.capacity());
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+typename HashSet<Key, Hash, KeyEqual>::const_iterator
+HashSet<Key, Hash, KeyEqual>::cbegin() const noexcept {
+  return begin();
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+typename HashSet<Key, Hash, KeyEqual>::const_iterator
+HashSet<Key, Hash, KeyEqual>::cend() const noexcept {
+  return end();
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+bool HashSet<Key, Hash, KeyEqual>::empty() const noexcept {
+  return table_.size() == 0;
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+typename HashSet<Key, Hash, KeyEqual>::size_type
+HashSet<Key, Hash, KeyEqual>::size() const noexcept {
+  return table_.size();
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+typename HashSet<Key, Hash, KeyEqual>::size_type
+HashSet<Key, Hash, KeyEqual>::max_size() const noexcept {
+  return table_.max_size();
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+typename HashSet<Key, Hash, KeyEqual>::size_type
+HashSet<Key, Hash, KeyEqual>::bucket_count() const noexcept {
+  return table_.capacity();
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+void HashSet<Key, Hash, KeyEqual>::reserve(size_type count) {
+  table_.reserve(count);
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+void HashSet<Key, Hash, KeyEqual>::clear() noexcept {
+  table_.clear();
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+std::pair<typename HashSet<Key, Hash, KeyEqual>::iterator, bool>
+HashSet<Key, Hash, KeyEqual>::insert(const_reference value) {
+  auto [index, inserted] = table_.emplace(value, value);
+  return {iterator(&table_, index), inserted};
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+template <typename... Args>
+std::vector<std::pair<typename HashSet<Key, Hash, KeyEqual>::iterator, bool>>
+HashSet<Key, Hash, KeyEqual>::insert_many(Args&&... args) {
+  // Запас места заранее: итераторы из results не инвалидируются
+  std::vector<std::pair<iterator, bool>> results;
+  table_.reserve(size() + sizeof...(Args));
+  (results.push_back(insert(std::forward<Args>(args))), ...);
+  return results;
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+void HashSet<Key, Hash, KeyEqual>::erase(iterator pos) {
+  if (pos.index_ < table_.capacity()) table_.erase_at(pos.index_);
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+void HashSet<Key, Hash, KeyEqual>::swap(HashSet& other) noexcept {
+  table_.swap(other.table_);
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+void HashSet<Key, Hash, KeyEqual>::merge(HashSet& other) {
+  if (this == &other) return;
+  const Table& source = other.table_;
+  for (size_type i = source.next_full(0); i < source.capacity();
+       i = source.next_full(i + 1)) {
+    const Key& key = source.slot(i);
+    table_.emplace(key, key);
+  }
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+typename HashSet<Key, Hash, KeyEqual>::iterator
+HashSet<Key, Hash, KeyEqual>::find(const Key& key) const {
+  size_type index = table_.find(key);
+  return index == Table::npos ? end() : iterator(&table_, index);
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+bool HashSet<Key, Hash, KeyEqual>::contains(const Key& key) const {
+  return table_.find(key) != Table::npos;
+}
+
+}  // namespace s21
@@ -112,18 +112,7 @@ void Set<Key>::clear() {
 template <typename Key>
 std::pair<typename Set<Key>::iterator, bool> Set<Key>::insert(
     const_reference value) {
-  // Сначала пытаемся найти элемент
-  iterator it = find(value);
-  if (it != end()) {
-    // Если элемент найден, возвращаем итератор на него и false
-    return std::make_pair(it, false);
-  } else {
-    // Если элемент не найден, вставляем его
-    tree_.insert(value);
-    // Возвращаем итератор на вставленный элемент и true
-    it = find(value);  // После вставки находим его местоположение
-    return std::make_pair(it, true);
-  }
+  return tree_.insert(value);
 }
 
 template <typename T>
@@ -154,22 +143,12 @@ void Set<Key>::merge(Set& other) {
 
 template <typename Key>
 typename Set<Key>::iterator Set<Key>::find(const Key& key) {
-  for (iterator it = tree_.begin(); it != tree_.end(); ++it) {
-    if (*it == key) {
-      return it;  // Возвращаем итератор на найденный элемент
-    }
-  }
-  return tree_.end();  // Если элемент не найден
+  return tree_.find(key);
 }
 
 template <typename Key>
 bool Set<Key>::contains(const Key& key) {
-  for (iterator it = tree_.begin(); it != tree_.end(); ++it) {
-    if (*it == key) {
-      return true;  // Возвращаем итератор на найденный элемент
-    }
-  }
-  return false;  // Если элемент не найден
+  return tree_.contains(key);
 }
 
 }  // namespace s21
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 #include <iostream>
+#include <limits>
 #include <vector>
 namespace s21 {
 template <typename T>
@@ -43,7 +44,7 @@ class BinaryTree {
 
  public:
   // addition foo
-  void insert(const_reference data);
+  std::pair<iterator, bool> insert(const_reference data);
   void erase(iterator pos);
   bool empty();
   void swap(BinaryTree& other);
@@ -51,13 +52,15 @@ class BinaryTree {
   size_type size();
   size_type max_size();
   void clear();
+  iterator find(const_reference data);
+  bool contains(const_reference data) const;
 
   // Вспомогательные функции
  private:
   void delete_tree(Node*& node);
-  Node* insert(Node* node, Node* parent_node, const_reference data);
   void replace_node(Node* old_node, Node* new_node);
   Node* find_min(Node* node) const;
+  Node* find_node(Node* node, const_reference data) const;
 
  public:  // iterators
   iterator begin();
@@ -175,8 +178,31 @@ void BinaryTree<T>::delete_tree(Node*& node) {
 }
 
 template <typename T>
-void BinaryTree<T>::insert(const_reference data) {
-  root_ = insert(root_, nullptr, data);
+std::pair<typename BinaryTree<T>::iterator, bool> BinaryTree<T>::insert(
+    const_reference data) {
+  Node* parent_node = nullptr;
+  Node* node = root_;
+  while (node) {
+    parent_node = node;
+    if (data < node->data_) {
+      node = node->left;
+    } else if (data > node->data_) {
+      node = node->right;
+    } else {
+      return std::make_pair(SetIterator(node), false);
+    }
+  }
+
+  node = new Node(data, parent_node);
+  if (!parent_node) {
+    root_ = node;
+  } else if (data < parent_node->data_) {
+    parent_node->left = node;
+  } else {
+    parent_node->right = node;
+  }
+  ++size_;
+  return std::make_pair(SetIterator(node), true);
 }
 
 template <typename T>
@@ -220,21 +246,13 @@ void BinaryTree<T>::clear() {
 }
 
 template <typename T>
-typename BinaryTree<T>::Node* BinaryTree<T>::insert(
-    typename BinaryTree<T>::Node* node,
-    typename BinaryTree<T>::Node* parent_node, const_reference data) {
-  if (!node) {
-    ++size_;
-    return new Node(data, parent_node);
-  }
-  if (data < node->data_) {
-    node->left = insert(node->left, node, data);
-  } else if (data > node->data_)  // !! для повторяющихся значений не пройдет
-  {
-    node->right = insert(node->right, node, data);
-  }
+typename BinaryTree<T>::iterator BinaryTree<T>::find(const_reference data) {
+  return SetIterator(find_node(root_, data));
+}
 
-  return node;
+template <typename T>
+bool BinaryTree<T>::contains(const_reference data) const {
+  return find_node(root_, data) != nullptr;
 }
 
 template <typename T>
@@ -278,6 +296,21 @@ typename BinaryTree<T>::Node* BinaryTree<T>::find_min(Node* node) const {
   return node;
 }
 
+template <typename T>
+typename BinaryTree<T>::Node* BinaryTree<T>::find_node(
+    Node* node, const_reference data) const {
+  while (node) {
+    if (data < node->data_) {
+      node = node->left;
+    } else if (data > node->data_) {
+      node = node->right;
+    } else {
+      return node;
+    }
+  }
+  return nullptr;
+}
+
 template <typename T>
 void BinaryTree<T>::replace_node(Node* old_node, Node* new_node) {
   if (old_node->parent) {
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "s21_epoch.h"
+
+namespace s21 {
+// Стек Трайбера: вершина меняется одним compare_exchange, мьютекса нет.
+// В слове вершины рядом с адресом узла хранится 16-битный счётчик
+// изменений, поэтому CAS не спутает старую вершину с новым узлом по тому
+// же адресу (ABA). Снятые узлы удаляются через EpochDomain: поток, который
+// ещё читает next у снятого узла, не получит освобождённую память.
+// Упаковка рассчитана на 48-битные адреса пользовательского пространства
+// (x86-64, AArch64).
+template <typename T>
+class ConcurrentStack {
+  static_assert(sizeof(void*) == 8,
+                "ConcurrentStack packs tagged pointers into 64 bits");
+
+ public:  // members
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = std::size_t;
+
+ public:  // constructors
+  ConcurrentStack() = default;
+  ConcurrentStack(const ConcurrentStack&) = delete;
+  ConcurrentStack& operator=(const ConcurrentStack&) = delete;
+  ~ConcurrentStack();
+
+ public:  // modifiers
+  template <typename... Args>
+  void emplace(Args&&... args);
+  void push(const_reference value);
+  void push(value_type&& value);
+  bool try_pop(reference out);
+
+ public:  // capacity
+  bool empty() const noexcept;
+
+ private:  // nodes
+  struct Node {
+    template <typename... Args>
+    explicit Node(Args&&... args) : value(std::forward<Args>(args)...) {}
+
+    T value;
+    Node* next = nullptr;
+  };
+
+  static constexpr int kTagShift = 48;
+  static constexpr std::uint64_t kPointerMask = (1ULL << kTagShift) - 1;
+
+  static Node* pointer(std::uint64_t head) noexcept {
+    return reinterpret_cast<Node*>(head & kPointerMask);
+  }
+  static std::uint64_t pack(Node* node, std::uint64_t old_head) noexcept {
+    const std::uint64_t tag = (old_head >> kTagShift) + 1;
+    return reinterpret_cast<std::uint64_t>(node) | (tag << kTagShift);
+  }
+  static void destroy(void* node) { delete static_cast<Node*>(node); }
+
+ private:  // attributes
+  std::atomic<std::uint64_t> head_{0};
+};
+
+template <typename T>
+ConcurrentStack<T>::~ConcurrentStack() {
+  Node* node = pointer(head_.load(std::memory_order_acquire));
+  while (node) {
+    Node* next = node->next;
+    delete node;
+    node = next;
+  }
+}
+
+template <typename T>
+template <typename... Args>
+void ConcurrentStack<T>::emplace(Args&&... args) {
+  // Вставке защита эпохой не нужна: она не читает чужие узлы
+  Node* node = new Node(std::forward<Args>(args)...);
+  std::uint64_t head = head_.load(std::memory_order_relaxed);
+  do {
+    node->next = pointer(head);
+  } while (!head_.compare_exchange_weak(head, pack(node, head),
+                                        std::memory_order_release,
+                                        std::memory_order_relaxed));
+}
+
+template <typename T>
+void ConcurrentStack<T>::push(const_reference value) {
+  emplace(value);
+}
+
+template <typename T>
+void ConcurrentStack<T>::push(value_type&& value) {
+  emplace(std::move(value));
+}
+
+template <typename T>
+bool ConcurrentStack<T>::try_pop(reference out) {
+  EpochGuard guard;
+  std::uint64_t head = head_.load(std::memory_order_acquire);
+  Node* node;
+  do {
+    node = pointer(head);
+    if (!node) return false;
+  } while (!head_.compare_exchange_weak(head, pack(node->next, head),
+                                        std::memory_order_acquire,
+                                        std::memory_order_acquire));
+  out = std::move(node->value);
+  EpochDomain::instance().retire(node, &ConcurrentStack::destroy);
+  return true;
+}
+
+template <typename T>
+bool ConcurrentStack<T>::empty() const noexcept {
+  return pointer(head_.load(std::memory_order_acquire)) == nullptr;
+}
+}  // namespace s21
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace s21 {
+// Освобождение памяти по эпохам для lock-free контейнеров. Поток, который
+// читает разделяемые узлы, держит EpochGuard: пока он закреплён в эпохе e,
+// глобальная эпоха не уйдёт дальше e + 1. Удалённый из структуры узел
+// передаётся в retire() с меткой текущей глобальной эпохи g и удаляется,
+// когда глобальная эпоха достигнет g + 2: к этому моменту все потоки,
+// которые могли его видеть, уже открепились.
+class EpochDomain {
+ public:  // members
+  using size_type = std::size_t;
+  using deleter_type = void (*)(void*);
+
+  static constexpr size_type kCacheLine = 64;
+  static constexpr size_type kCollectThreshold = 64;
+
+ public:  // access
+  static EpochDomain& instance() noexcept {
+    static EpochDomain domain;
+    return domain;
+  }
+
+ public:  // pinning
+  void enter();
+  void exit() noexcept;
+  void retire(void* ptr, deleter_type deleter);
+
+ private:  // records
+  struct Retired {
+    void* ptr;
+    deleter_type deleter;
+  };
+
+  struct Bag {
+    std::uint64_t epoch = 0;
+    std::vector<Retired> items;
+  };
+
+  // Запись потока; записи не освобождаются и переходят к новым потокам
+  struct alignas(kCacheLine) Record {
+    std::atomic<std::uint64_t> state{0};  // (эпоха << 1) | закреплён
+    std::atomic<bool> owned{true};
+    Record* next = nullptr;
+    size_type depth = 0;
+    Bag bags[3];
+  };
+
+  // Владение записью на время жизни потока
+  struct Handle {
+    Record* record = nullptr;
+    ~Handle() {
+      if (record) record->owned.store(false, std::memory_order_release);
+    }
+  };
+
+ private:  // attributes
+  alignas(kCacheLine) std::atomic<std::uint64_t> epoch_{1};
+  alignas(kCacheLine) std::atomic<Record*> records_{nullptr};
+
+ private:  // helpers
+  EpochDomain() = default;
+  Record& local();
+  Record* acquire_record();
+  bool try_advance();
+  static void collect(Bag& bag) noexcept;
+};
+
+// Закрепление текущего потока в эпохе на время чтения узлов
+class EpochGuard {
+ public:  // constructors
+  EpochGuard() : domain_(EpochDomain::instance()) { domain_.enter(); }
+  EpochGuard(const EpochGuard&) = delete;
+  EpochGuard& operator=(const EpochGuard&) = delete;
+  ~EpochGuard() { domain_.exit(); }
+
+ private:  // attributes
+  EpochDomain& domain_;
+};
+
+inline void EpochDomain::enter() {
+  Record& record = local();
+  if (record.depth++ > 0) return;
+  const std::uint64_t epoch = epoch_.load(std::memory_order_acquire);
+  // Обмен с seq_cst работает как полный барьер: последующие чтения узлов
+  // не поднимаются выше публикации эпохи
+  record.state.exchange((epoch << 1) | 1, std::memory_order_seq_cst);
+  for (Bag& bag : record.bags) {
+    if (!bag.items.empty() && bag.epoch + 2 <= epoch) collect(bag);
+  }
+}
+
+inline void EpochDomain::exit() noexcept {
+  Record& record = local();
+  if (--record.depth > 0) return;
+  record.state.store(0, std::memory_order_release);
+}
+
+inline void EpochDomain::retire(void* ptr, deleter_type deleter) {
+  Record& record = local();
+  const std::uint64_t epoch = epoch_.load(std::memory_order_seq_cst);
+  Bag& bag = record.bags[epoch % 3];
+  if (bag.epoch != epoch) {
+    // В слоте лежит мешок эпохи не новее epoch - 3, его уже можно удалить
+    collect(bag);
+    bag.epoch = epoch;
+  }
+  bag.items.push_back(Retired{ptr, deleter});
+  if (bag.items.size() >= kCollectThreshold && try_advance()) {
+    const std::uint64_t now = epoch_.load(std::memory_order_acquire);
+    for (Bag& other : record.bags) {
+      if (!other.items.empty() && other.epoch + 2 <= now) collect(other);
+    }
+  }
+}
+
+inline EpochDomain::Record& EpochDomain::local() {
+  static thread_local Handle handle;
+  if (!handle.record) handle.record = acquire_record();
+  return *handle.record;
+}
+
+inline EpochDomain::Record* EpochDomain::acquire_record() {
+  for (Record* record = records_.load(std::memory_order_acquire); record;
+       record = record->next) {
+    bool owned = false;
+    if (record->owned.compare_exchange_strong(owned, true,
+                                              std::memory_order_acquire)) {
+      return record;
+    }
+  }
+  Record* record = new Record;
+  record->next = records_.load(std::memory_order_relaxed);
+  while (!records_.compare_exchange_weak(record->next, record,
+                                         std::memory_order_release,
+                                         std::memory_order_relaxed)) {
+  }
+  return record;
+}
+
+inline bool EpochDomain::try_advance() {
+  // Эпоха сдвигается, только если все закреплённые потоки уже в ней
+  std::uint64_t epoch = epoch_.load(std::memory_order_seq_cst);
+  for (Record* record = records_.load(std::memory_order_acquire); record;
+       record = record->next) {
+    const std::uint64_t state = record->state.load(std::memory_order_seq_cst);
+    if ((state & 1) && (state >> 1) != epoch) return false;
+  }
+  // Неудача CAS значит, что эпоху уже сдвинул другой поток
+  epoch_.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst);
+  return true;
+}
+
+inline void EpochDomain::collect(Bag& bag) noexcept {
+  for (const Retired& item : bag.items) item.deleter(item.ptr);
+  bag.items.clear();
+}
+}  // namespace s21
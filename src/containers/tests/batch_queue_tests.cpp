@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include "../queue/s21_batch_queue.h"
+
+class BatchQueueTests : public ::testing::Test {
+ protected:
+  void SetUp() override {}
+  void TearDown() override {}
+};
+
+TEST_F(BatchQueueTests, bulkPushPopKeepsOrder) {
+  s21::BatchQueue<int> queue;
+  std::vector<int> items(10);
+  std::iota(items.begin(), items.end(), 0);
+  EXPECT_EQ(queue.push_bulk(items), 10u);
+  EXPECT_EQ(items.size(), 10u);
+  EXPECT_TRUE(queue.push(10));
+  EXPECT_EQ(queue.size(), 11u);
+
+  std::vector<int> out;
+  EXPECT_EQ(queue.pop_bulk(std::back_inserter(out), 4), 4u);
+  EXPECT_EQ(queue.pop_bulk(std::back_inserter(out), 100,
+                           std::chrono::milliseconds(0)),
+            7u);
+  ASSERT_EQ(out.size(), 11u);
+  for (int i = 0; i < 11; ++i) EXPECT_EQ(out[i], i);
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST_F(BatchQueueTests, popBulkTimesOutWhenEmpty) {
+  s21::BatchQueue<int> queue;
+  int buffer[4];
+  auto start = std::chrono::steady_clock::now();
+  EXPECT_EQ(queue.pop_bulk(buffer, 4, std::chrono::milliseconds(20)), 0u);
+  EXPECT_GE(std::chrono::steady_clock::now() - start,
+            std::chrono::milliseconds(20));
+  int value = 0;
+  EXPECT_FALSE(queue.try_pop(value));
+}
+
+TEST_F(BatchQueueTests, movesFromTemporaryRange) {
+  s21::BatchQueue<std::unique_ptr<int>> queue;
+  std::vector<std::unique_ptr<int>> items;
+  for (int i = 0; i < 3; ++i) items.push_back(std::make_unique<int>(i));
+  EXPECT_EQ(queue.push_bulk(std::move(items)), 3u);
+  EXPECT_TRUE(queue.push(std::make_unique<int>(3)));
+
+  std::unique_ptr<int> out[4];
+  EXPECT_EQ(queue.pop_bulk(out, 4), 4u);
+  for (int i = 0; i < 4; ++i) EXPECT_EQ(*out[i], i);
+}
+
+TEST_F(BatchQueueTests, closeDrainsRemainingItems) {
+  s21::BatchQueue<int> queue;
+  queue.push_bulk(std::vector<int>{1, 2, 3});
+  queue.close();
+  EXPECT_TRUE(queue.is_closed());
+  EXPECT_FALSE(queue.push(4));
+  EXPECT_EQ(queue.push_bulk(std::vector<int>{5, 6}), 0u);
+
+  int value = 0;
+  EXPECT_TRUE(queue.pop(value));
+  EXPECT_EQ(value, 1);
+  std::vector<int> out;
+  EXPECT_EQ(queue.pop_bulk(std::back_inserter(out), 10), 2u);
+  EXPECT_EQ(out, (std::vector<int>{2, 3}));
+  // Закрытая и пустая очередь не блокирует
+  EXPECT_FALSE(queue.pop(value));
+  EXPECT_EQ(queue.pop_bulk(std::back_inserter(out), 10), 0u);
+}
+
+TEST_F(BatchQueueTests, closeWakesBlockedConsumer) {
+  s21::BatchQueue<int> queue;
+  bool result = true;
+  std::thread consumer([&] {
+    int value = 0;
+    result = queue.pop(value);
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  queue.close();
+  consumer.join();
+  EXPECT_FALSE(result);
+}
+
+TEST_F(BatchQueueTests, boundedPushBulkWaitsForSpace) {
+  s21::BatchQueue<int> queue(4);
+  EXPECT_EQ(queue.capacity(), 4u);
+  std::vector<int> items(100);
+  std::iota(items.begin(), items.end(), 0);
+  std::thread producer([&] {
+    EXPECT_EQ(queue.push_bulk(items), 100u);
+    queue.close();
+  });
+
+  std::vector<int> out;
+  int buffer[3];
+  while (std::size_t n = queue.pop_bulk(buffer, 3)) {
+    EXPECT_LE(queue.size(), 4u);
+    out.insert(out.end(), buffer, buffer + n);
+  }
+  producer.join();
+  EXPECT_EQ(out, items);
+}
+
+TEST_F(BatchQueueTests, manyProducersManyConsumers) {
+  constexpr int kProducers = 3;
+  constexpr int kConsumers = 3;
+  constexpr int kPerProducer = 3000;
+  s21::BatchQueue<int> queue(64);
+
+  std::vector<std::thread> producers;
+  for (int p = 0; p < kProducers; ++p) {
+    producers.emplace_back([&queue, p] {
+      std::vector<int> batch;
+      for (int i = 0; i < kPerProducer; ++i) {
+        batch.push_back(p * kPerProducer + i);
+        if (batch.size() == 16) {
+          queue.push_bulk(batch);
+          batch.clear();
+        }
+      }
+      queue.push_bulk(batch);
+    });
+  }
+
+  std::vector<std::vector<int>> received(kConsumers);
+  std::vector<std::thread> consumers;
+  for (int c = 0; c < kConsumers; ++c) {
+    consumers.emplace_back([&queue, &received, c] {
+      int buffer[32];
+      while (std::size_t n = queue.pop_bulk(buffer, 32)) {
+        received[c].insert(received[c].end(), buffer, buffer + n);
+      }
+    });
+  }
+
+  for (auto &producer : producers) producer.join();
+  queue.close();
+  for (auto &consumer : consumers) consumer.join();
+
+  std::vector<int> seen(kProducers * kPerProducer, 0);
+  for (const auto &part : received) {
+    // Порядок одного производителя сохраняется у каждого потребителя
+    std::vector<int> last(kProducers, -1);
+    for (int value : part) {
+      ++seen[value];
+      EXPECT_GT(value, last[value / kPerProducer]);
+      last[value / kPerProducer] = value;
+    }
+  }
+  for (int count : seen) EXPECT_EQ(count, 1);
+}
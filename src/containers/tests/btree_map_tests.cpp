@@ -0,0 +1,165 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../map/s21_btree_map.h"
+
+class BTreeMapTests : public ::testing::Test {
+ protected:
+  void SetUp() override {}
+  void TearDown() override {}
+};
+
+// Узлы по 4 слота: даже небольшие наборы дают дерево в несколько уровней
+using SmallNodeMap = s21::BTreeMap<int, int, 64>;
+
+template <typename MapType, typename Expected>
+void expect_same(MapType &map, const Expected &expected) {
+  ASSERT_EQ(map.size(), expected.size());
+  auto it = map.begin();
+  for (const auto &item : expected) {
+    ASSERT_NE(it, map.end());
+    EXPECT_EQ((*it).first, item.first);
+    EXPECT_EQ((*it).second, item.second);
+    ++it;
+  }
+  EXPECT_EQ(it, map.end());
+}
+
+TEST_F(BTreeMapTests, MapInterface) {
+  s21::BTreeMap<int, int> map = {std::make_pair(1, 1), std::make_pair(2, 2),
+                                 std::make_pair(3, 3), std::make_pair(-1, 4)};
+  EXPECT_EQ(map.size(), 4u);
+  EXPECT_FALSE(map.empty());
+  EXPECT_EQ(map.at(-1), 4);
+  EXPECT_THROW(map.at(10), std::out_of_range);
+  EXPECT_TRUE(map.contains(2));
+  EXPECT_FALSE(map.contains(5));
+
+  auto result = map.insert(2, 20);
+  EXPECT_FALSE(result.second);
+  EXPECT_EQ((*result.first).second, 2);
+  result = map.insert_or_assign(2, 20);
+  EXPECT_FALSE(result.second);
+  EXPECT_EQ(map.at(2), 20);
+  result = map.insert_or_assign(7, 70);
+  EXPECT_TRUE(result.second);
+  EXPECT_EQ((*result.first).first, 7);
+
+  map[8] = 80;
+  EXPECT_EQ(map[8], 80);
+  EXPECT_EQ(map[9], 0);
+  (*map.find(9)).second = 90;
+  EXPECT_EQ(map.at(9), 90);
+
+  auto inserted = map.insert_many(std::make_pair(4, 4), std::make_pair(1, 0));
+  EXPECT_TRUE(inserted[0].second);
+  EXPECT_FALSE(inserted[1].second);
+
+  map.erase(map.find(1));
+  map.erase(map.end());
+  expect_same(map, std::map<int, int>{
+                       {-1, 4}, {2, 20}, {3, 3}, {4, 4}, {7, 70}, {8, 80},
+                       {9, 90}});
+
+  auto last = map.end();
+  --last;
+  EXPECT_EQ(last.key(), 9);
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.begin(), map.end());
+}
+
+TEST_F(BTreeMapTests, CopyMoveSwapMerge) {
+  SmallNodeMap map;
+  for (int i = 0; i < 100; ++i) map.insert(i, i * i);
+  SmallNodeMap copy(map);
+  SmallNodeMap moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(moved.size(), 100u);
+  EXPECT_EQ(moved.at(99), 9801);
+
+  SmallNodeMap assigned;
+  assigned = moved;
+  assigned.erase(assigned.find(0));
+  EXPECT_EQ(moved.size(), 100u);
+  EXPECT_EQ(assigned.size(), 99u);
+
+  SmallNodeMap other;
+  for (int i = 50; i < 150; ++i) other.insert(i, -i);
+  map.merge(other);
+  EXPECT_EQ(map.size(), 150u);
+  EXPECT_EQ(map.at(149), -149);
+  EXPECT_EQ(map.at(50), 2500);
+  // Как у s21::Map: пары копируются, other не меняется
+  EXPECT_EQ(other.size(), 100u);
+  EXPECT_EQ(other.at(50), -50);
+  EXPECT_EQ(other.at(149), -149);
+
+  map.swap(other);
+  EXPECT_EQ(map.size(), 100u);
+  EXPECT_EQ(other.size(), 150u);
+}
+
+TEST_F(BTreeMapTests, RandomOperationsMatchStdMap) {
+  std::mt19937 gen(2024);
+  std::uniform_int_distribution<int> key(0, 2000);
+  SmallNodeMap map;
+  std::map<int, int> expected;
+  for (int step = 0; step < 20000; ++step) {
+    int k = key(gen);
+    if (step % 3 == 0) {
+      auto it = map.find(k);
+      EXPECT_EQ(it != map.end(), expected.count(k) == 1);
+      if (it != map.end()) map.erase(it);
+      expected.erase(k);
+    } else {
+      map.insert_or_assign(k, step);
+      expected[k] = step;
+    }
+  }
+  expect_same(map, expected);
+
+  // Удаление всего подряд проводит через слияния до пустого корня
+  while (!expected.empty()) {
+    auto victim = expected.begin();
+    std::advance(victim, expected.size() / 2);
+    map.erase(map.find(victim->first));
+    expected.erase(victim);
+    ASSERT_EQ(map.size(), expected.size());
+  }
+  EXPECT_TRUE(map.empty());
+  map.insert(1, 1);
+  EXPECT_EQ(map.at(1), 1);
+}
+
+TEST_F(BTreeMapTests, SequentialLoadAndReverseIteration) {
+  SmallNodeMap map;
+  for (int i = 0; i < 1000; ++i) map.insert(i, i);
+  int expected = 999;
+  for (auto it = --map.end();; --it) {
+    EXPECT_EQ(it.key(), expected--);
+    if (it == map.begin()) break;
+  }
+  EXPECT_EQ(expected, -1);
+  for (int i = 0; i < 1000; i += 2) map.erase(map.find(i));
+  auto it = map.cbegin();
+  for (int i = 1; i < 1000; i += 2, ++it) EXPECT_EQ(it.value(), i);
+  EXPECT_EQ(it, map.cend());
+}
+
+TEST_F(BTreeMapTests, NonTrivialKeysAndValues) {
+  s21::BTreeMap<std::string, std::vector<int>, 128> map;
+  for (int i = 0; i < 300; ++i) {
+    map.insert(std::to_string(i), std::vector<int>(i % 5, i));
+  }
+  EXPECT_EQ(map.at("42"), std::vector<int>(2, 42));
+  EXPECT_EQ(map.begin().key(), "0");
+  for (int i = 0; i < 300; i += 3) map.erase(map.find(std::to_string(i)));
+  EXPECT_EQ(map.size(), 200u);
+  EXPECT_FALSE(map.contains("42"));
+  EXPECT_EQ(map.at("43"), std::vector<int>(3, 43));
+}
@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../stack/s21_concurrent_stack.h"
+
+class ConcurrentStackTests : public ::testing::Test {
+ protected:
+  void SetUp() override {}
+  void TearDown() override {}
+};
+
+TEST_F(ConcurrentStackTests, LifoOrder) {
+  s21::ConcurrentStack<int> stack;
+  EXPECT_TRUE(stack.empty());
+  for (int i = 0; i < 5; ++i) stack.push(i);
+  EXPECT_FALSE(stack.empty());
+  int value = -1;
+  for (int i = 4; i >= 0; --i) {
+    EXPECT_TRUE(stack.try_pop(value));
+    EXPECT_EQ(value, i);
+  }
+  EXPECT_FALSE(stack.try_pop(value));
+  EXPECT_TRUE(stack.empty());
+}
+
+TEST_F(ConcurrentStackTests, MoveOnlyAndDestroysRemaining) {
+  auto tracked = std::make_shared<std::string>("tracked");
+  {
+    s21::ConcurrentStack<std::unique_ptr<int>> pointers;
+    pointers.emplace(new int(7));
+    pointers.push(std::make_unique<int>(8));
+    std::unique_ptr<int> out;
+    EXPECT_TRUE(pointers.try_pop(out));
+    EXPECT_EQ(*out, 8);
+
+    s21::ConcurrentStack<std::shared_ptr<std::string>> strings;
+    strings.push(tracked);
+    strings.push(tracked);
+    EXPECT_EQ(tracked.use_count(), 3);
+  }
+  EXPECT_EQ(tracked.use_count(), 1);
+}
+
+TEST_F(ConcurrentStackTests, ConcurrentPushPopKeepsEveryItem) {
+  constexpr int kThreads = 4;
+  constexpr int kPerThread = 5000;
+  s21::ConcurrentStack<int> stack;
+  std::vector<std::atomic<int>> seen(kThreads * kPerThread);
+  for (auto &count : seen) count.store(0);
+
+  // Каждый поток кладёт свои значения и снимает чужие вперемешку, так что
+  // узлы постоянно освобождаются под читающими потоками
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&, t] {
+      int value;
+      for (int i = 0; i < kPerThread; ++i) {
+        stack.push(t * kPerThread + i);
+        if (i % 2 == 1) {
+          for (int k = 0; k < 2; ++k) {
+            if (stack.try_pop(value)) seen[value].fetch_add(1);
+          }
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  int value;
+  while (stack.try_pop(value)) seen[value].fetch_add(1);
+  for (const auto &count : seen) EXPECT_EQ(count.load(), 1);
+}
@@ -0,0 +1,273 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../map/s21_hash_map.h"
+
+class HashMapTests : public ::testing::Test {
+ protected:
+  void SetUp() override {}
+  void TearDown() override {}
+};
+
+// Все ключи попадают в одну цепочку пробирования с одинаковым H2
+struct ConstantHash {
+  std::size_t operator()(int) const { return 42; }
+};
+
+// Считает созданные значения
+struct Counted {
+  static inline int built = 0;
+  int value = 7;
+  Counted() { ++built; }
+  Counted(const Counted &other) : value(other.value) { ++built; }
+  Counted(Counted &&other) noexcept : value(other.value) { ++built; }
+  Counted &operator=(const Counted &) = default;
+};
+
+// Бросает на ключе 13, пока взведён
+struct ArmedHash {
+  static inline bool armed = false;
+  std::size_t operator()(int key) const {
+    if (armed && key == 13) throw std::runtime_error("hash failed");
+    return std::hash<int>()(key);
+  }
+};
+
+// Перемещение может бросить, поэтому при росте таблицы значение копируется;
+// копирование бросает, пока взведено
+struct ArmedCopy {
+  static inline bool armed = false;
+  int value = 0;
+  ArmedCopy(int v = 0) : value(v) {}
+  ArmedCopy(const ArmedCopy &other) : value(other.value) {
+    if (armed && value == 13) throw std::runtime_error("copy failed");
+  }
+  ArmedCopy(ArmedCopy &&other) : value(other.value) {}
+  ArmedCopy &operator=(const ArmedCopy &) = default;
+};
+
+template <typename MapType>
+std::map<int, int> to_std_map(const MapType &map) {
+  std::map<int, int> result;
+  for (auto it = map.cbegin(); it != map.cend(); ++it) {
+    EXPECT_TRUE(result.emplace(it.key(), it.value()).second);
+  }
+  return result;
+}
+
+TEST_F(HashMapTests, MapInterface) {
+  s21::HashMap<int, int> map = {std::make_pair(1, 1), std::make_pair(2, 2),
+                                std::make_pair(3, 3), std::make_pair(-1, 4)};
+  EXPECT_EQ(map.size(), 4u);
+  EXPECT_FALSE(map.empty());
+  EXPECT_EQ(map.at(-1), 4);
+  EXPECT_THROW(map.at(10), std::out_of_range);
+  EXPECT_TRUE(map.contains(2));
+  EXPECT_FALSE(map.contains(5));
+
+  auto result = map.insert(2, 20);
+  EXPECT_FALSE(result.second);
+  EXPECT_EQ((*result.first).second, 2);
+  result = map.insert_or_assign(2, 20);
+  EXPECT_FALSE(result.second);
+  EXPECT_EQ(map.at(2), 20);
+  result = map.insert_or_assign(7, 70);
+  EXPECT_TRUE(result.second);
+  EXPECT_EQ((*result.first).first, 7);
+
+  map[8] = 80;
+  EXPECT_EQ(map[8], 80);
+  EXPECT_EQ(map[9], 0);
+  (*map.find(9)).second = 90;
+  EXPECT_EQ(map.at(9), 90);
+
+  auto inserted = map.insert_many(std::make_pair(4, 4), std::make_pair(1, 0));
+  EXPECT_TRUE(inserted[0].second);
+  EXPECT_FALSE(inserted[1].second);
+
+  map.erase(map.find(1));
+  map.erase(map.end());
+  EXPECT_EQ(to_std_map(map),
+            (std::map<int, int>{
+                {-1, 4}, {2, 20}, {3, 3}, {4, 4}, {7, 70}, {8, 80}, {9, 90}}));
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.begin(), map.end());
+  EXPECT_FALSE(map.contains(2));
+}
+
+TEST_F(HashMapTests, SubscriptBuildsValueOnlyOnInsert) {
+  s21::HashMap<int, Counted> map;
+  Counted::built = 0;
+  map[1].value = 10;
+  EXPECT_EQ(Counted::built, 1);
+  EXPECT_EQ(map[1].value, 10);
+  EXPECT_EQ(map[1].value, 10);
+  EXPECT_EQ(Counted::built, 1);
+  EXPECT_EQ(map[2].value, 7);
+  EXPECT_EQ(Counted::built, 2);
+}
+
+TEST_F(HashMapTests, CopyMoveSwapMerge) {
+  s21::HashMap<int, int> map;
+  for (int i = 0; i < 100; ++i) map.insert(i, i * i);
+  s21::HashMap<int, int> copy(map);
+  s21::HashMap<int, int> moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(moved.size(), 100u);
+  EXPECT_EQ(moved.at(99), 9801);
+
+  s21::HashMap<int, int> assigned;
+  assigned = moved;
+  assigned.erase(assigned.find(0));
+  EXPECT_EQ(moved.size(), 100u);
+  EXPECT_EQ(assigned.size(), 99u);
+
+  s21::HashMap<int, int> other;
+  for (int i = 50; i < 150; ++i) other.insert(i, -i);
+  map.merge(other);
+  EXPECT_EQ(map.size(), 150u);
+  EXPECT_EQ(map.at(149), -149);
+  EXPECT_EQ(map.at(50), 2500);
+  // Как у s21::Map: пары копируются, other не меняется
+  EXPECT_EQ(other.size(), 100u);
+  EXPECT_EQ(other.at(50), -50);
+  EXPECT_EQ(other.at(149), -149);
+
+  map.swap(other);
+  EXPECT_EQ(map.size(), 100u);
+  EXPECT_EQ(other.size(), 150u);
+}
+
+TEST_F(HashMapTests, RandomOperationsMatchUnorderedMap) {
+  std::mt19937 gen(2024);
+  std::uniform_int_distribution<int> key(0, 3000);
+  s21::HashMap<int, int> map;
+  std::unordered_map<int, int> expected;
+  // Частые удаления оставляют надгробия, на которых держатся и поиск,
+  // и перехеширование на месте
+  for (int step = 0; step < 60000; ++step) {
+    int k = key(gen);
+    if (step % 2 == 0) {
+      auto it = map.find(k);
+      EXPECT_EQ(it != map.end(), expected.count(k) == 1);
+      if (it != map.end()) map.erase(it);
+      expected.erase(k);
+    } else {
+      map.insert_or_assign(k, step);
+      expected[k] = step;
+    }
+  }
+  ASSERT_EQ(map.size(), expected.size());
+  for (const auto &item : expected) EXPECT_EQ(map.at(item.first), item.second);
+  EXPECT_EQ(to_std_map(map).size(), expected.size());
+}
+
+TEST_F(HashMapTests, CollidingHashes) {
+  s21::HashMap<int, int, ConstantHash> map;
+  for (int i = 0; i < 200; ++i) map.insert(i, i);
+  for (int i = 0; i < 200; i += 2) map.erase(map.find(i));
+  EXPECT_EQ(map.size(), 100u);
+  for (int i = 0; i < 200; ++i) EXPECT_EQ(map.contains(i), i % 2 == 1);
+  for (int i = 0; i < 200; i += 2) map.insert(i, -i);
+  EXPECT_EQ(map.size(), 200u);
+  EXPECT_EQ(map.at(10), -10);
+  EXPECT_EQ(map.at(11), 11);
+}
+
+TEST_F(HashMapTests, InsertManyAfterEraseKeepsIterators) {
+  // 56 ключей заполняют таблицу на 64 слота до предела, удаление оставляет
+  // надгробия. Подбираем пару ключей, из которых по отдельности первый
+  // ещё помещается, а второй уже перехеширует таблицу: insert_many с этой
+  // парой не должен перехешировать её посреди пакета
+  auto make = [] {
+    s21::HashMap<int, int> map;
+    for (int i = 0; i < 56; ++i) map.insert(i, i);
+    map.erase(map.find(0));
+    map.erase(map.find(1));
+    return map;
+  };
+  ASSERT_EQ(make().bucket_count(), 64u);
+  int first = -1;
+  int second = -1;
+  for (int a = 100; a < 200 && second < 0; ++a) {
+    for (int b = 100; b < 200 && second < 0; ++b) {
+      if (a == b) continue;
+      auto map = make();
+      map.insert(a, 0);
+      if (map.bucket_count() != 64u) break;
+      map.insert(b, 0);
+      if (map.bucket_count() != 64u) {
+        first = a;
+        second = b;
+      }
+    }
+  }
+  ASSERT_GE(second, 0);
+
+  auto map = make();
+  auto results = map.insert_many(std::make_pair(first, -first),
+                                 std::make_pair(second, -second));
+  ASSERT_EQ(results.size(), 2u);
+  EXPECT_TRUE(results[0].second);
+  EXPECT_TRUE(results[1].second);
+  EXPECT_EQ((*results[0].first).first, first);
+  EXPECT_EQ((*results[0].first).second, -first);
+  EXPECT_EQ((*results[1].first).first, second);
+  EXPECT_EQ((*results[1].first).second, -second);
+  EXPECT_EQ(map.size(), 56u);
+}
+
+TEST_F(HashMapTests, ReserveAndNonTrivialValues) {
+  s21::HashMap<std::string, std::vector<int>> map;
+  map.reserve(1000);
+  const std::size_t buckets = map.bucket_count();
+  for (int i = 0; i < 1000; ++i) {
+    map.insert(std::to_string(i), std::vector<int>(i % 5, i));
+  }
+  EXPECT_EQ(map.bucket_count(), buckets);
+  EXPECT_EQ(map.at("42"), std::vector<int>(2, 42));
+  for (int i = 0; i < 1000; i += 3) map.erase(map.find(std::to_string(i)));
+  EXPECT_EQ(map.size(), 666u);
+  EXPECT_FALSE(map.contains("42"));
+  EXPECT_EQ(map.at("43"), std::vector<int>(3, 43));
+
+  const auto &view = map;
+  EXPECT_EQ(view.find("0"), view.end());
+  EXPECT_EQ(view.at("1").size(), 1u);
+
+  s21::HashMap<int, int> small;
+  EXPECT_THROW(small.reserve(small.max_size() + 1), std::length_error);
+  EXPECT_THROW(small.reserve(small.max_size() * 8), std::length_error);
+  EXPECT_EQ(small.bucket_count(), 0u);
+}
+
+TEST_F(HashMapTests, RehashKeepsTableOnException) {
+  s21::HashMap<int, int, ArmedHash> map;
+  for (int i = 0; i < 20; ++i) map.insert(i, -i);
+  const std::map<int, int> before = to_std_map(map);
+  ArmedHash::armed = true;
+  EXPECT_THROW(map.reserve(1000), std::runtime_error);
+  ArmedHash::armed = false;
+  EXPECT_EQ(map.size(), 20u);
+  EXPECT_EQ(to_std_map(map), before);
+  for (int i = 0; i < 20; ++i) EXPECT_EQ(map.at(i), -i);
+  map.reserve(1000);
+  EXPECT_EQ(to_std_map(map), before);
+
+  s21::HashMap<int, ArmedCopy> values;
+  for (int i = 0; i < 20; ++i) values.insert(i, ArmedCopy(i));
+  ArmedCopy::armed = true;
+  EXPECT_THROW(values.reserve(1000), std::runtime_error);
+  ArmedCopy::armed = false;
+  EXPECT_EQ(values.size(), 20u);
+  for (int i = 0; i < 20; ++i) EXPECT_EQ(values.at(i).value, i);
+  values.insert(20, ArmedCopy(20));
+  EXPECT_EQ(values.at(20).value, 20);
+}
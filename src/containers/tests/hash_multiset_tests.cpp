@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+
+#include "../multiset/s21_hash_multiset.h"
+
+class HashMultisetTests : public ::testing::Test {
+ protected:
+  void SetUp() override {}
+  void TearDown() override {}
+};
+
+// Бросает на ключе 13, пока взведён флаг
+struct ArmedHash {
+  static inline bool armed = false;
+  std::size_t operator()(int key) const {
+    if (armed && key == 13) throw std::runtime_error("hash failed");
+    return std::hash<int>()(key);
+  }
+};
+
+template <typename SetType>
+std::map<int, std::size_t> histogram(const SetType &set) {
+  std::map<int, std::size_t> result;
+  for (int key : set) ++result[key];
+  return result;
+}
+
+TEST_F(HashMultisetTests, MultisetInterface) {
+  s21::HashMultiset<int> set = {1, 3, 2, 2, 3, 3};
+  EXPECT_EQ(set.size(), 6u);
+  EXPECT_EQ(set.count(3), 3u);
+  EXPECT_EQ(set.count(2), 2u);
+  EXPECT_EQ(set.count(4), 0u);
+  EXPECT_TRUE(set.contains(1));
+  EXPECT_FALSE(set.contains(4));
+  EXPECT_EQ(*set.find(2), 2);
+  EXPECT_EQ(set.find(4), set.end());
+
+  auto result = set.insert(1);
+  EXPECT_TRUE(result.second);
+  EXPECT_EQ(*result.first, 1);
+  EXPECT_EQ(set.count(1), 2u);
+
+  auto range = set.equal_range(3);
+  std::size_t copies = 0;
+  for (auto it = range.first; it != range.second; ++it, ++copies) {
+    EXPECT_EQ(*it, 3);
+  }
+  EXPECT_EQ(copies, 3u);
+  auto missing = set.equal_range(4);
+  EXPECT_EQ(missing.first, set.end());
+  EXPECT_EQ(missing.second, set.end());
+
+  auto inserted = set.insert_many(5, 5, 2);
+  EXPECT_EQ(inserted.size(), 3u);
+  EXPECT_EQ(*inserted[1].first, 5);
+  EXPECT_EQ(set.count(5), 2u);
+  EXPECT_EQ(histogram(set),
+            (std::map<int, std::size_t>{{1, 2}, {2, 3}, {3, 3}, {5, 2}}));
+
+  // erase снимает по одной копии
+  set.erase(set.find(3));
+  EXPECT_EQ(set.count(3), 2u);
+  set.erase(set.find(3));
+  set.erase(set.find(3));
+  EXPECT_FALSE(set.contains(3));
+  set.erase(set.end());
+  EXPECT_EQ(set.size(), 7u);
+  set.clear();
+  EXPECT_TRUE(set.empty());
+  EXPECT_EQ(set.begin(), set.end());
+}
+
+TEST_F(HashMultisetTests, CopyMoveSwapMerge) {
+  s21::HashMultiset<int> set = {1, 3, 2, 2};
+  s21::HashMultiset<int> other = {2, 3, 4, 4, 5};
+  s21::HashMultiset<int> copy(set);
+  set.merge(other);
+  EXPECT_EQ(histogram(set), (std::map<int, std::size_t>{
+                                {1, 1}, {2, 3}, {3, 2}, {4, 2}, {5, 1}}));
+  EXPECT_EQ(set.size(), 9u);
+  // Как у s21::Multiset: элементы копируются, other не меняется
+  EXPECT_EQ(histogram(other),
+            (std::map<int, std::size_t>{{2, 1}, {3, 1}, {4, 2}, {5, 1}}));
+  EXPECT_EQ(other.size(), 5u);
+  EXPECT_EQ(copy.size(), 4u);
+
+  s21::HashMultiset<int> moved(std::move(set));
+  EXPECT_TRUE(set.empty());
+  EXPECT_EQ(moved.size(), 9u);
+  moved.swap(copy);
+  EXPECT_EQ(moved.size(), 4u);
+  EXPECT_EQ(copy.count(2), 3u);
+  set = copy;
+  EXPECT_EQ(histogram(set), histogram(copy));
+}
+
+TEST_F(HashMultisetTests, MergeKeepsSizesOnException) {
+  s21::HashMultiset<int, ArmedHash> set;
+  s21::HashMultiset<int, ArmedHash> other;
+  for (int i = 0; i < 40; ++i) {
+    set.insert(i % 5);
+    other.insert(i % 20);
+    other.insert(i % 20);
+  }
+  ArmedHash::armed = true;
+  EXPECT_THROW(set.merge(other), std::runtime_error);
+  ArmedHash::armed = false;
+
+  std::size_t total = 0;
+  for (const auto &[key, copies] : histogram(set)) total += copies;
+  EXPECT_EQ(set.size(), total);
+  total = 0;
+  for (const auto &[key, copies] : histogram(other)) total += copies;
+  EXPECT_EQ(other.size(), total);
+  EXPECT_EQ(other.size(), 80u);
+  EXPECT_EQ(other.count(13), 4u);
+  EXPECT_EQ(set.count(13), 0u);
+}
+
+TEST_F(HashMultisetTests, RandomOperationsMatchStdMultiset) {
+  std::mt19937 gen(11);
+  std::uniform_int_distribution<int> key(0, 500);
+  s21::HashMultiset<std::string> set;
+  std::multiset<std::string> expected;
+  for (int step = 0; step < 30000; ++step) {
+    std::string k = std::to_string(key(gen));
+    if (step % 3 == 0) {
+      auto it = set.find(k);
+      EXPECT_EQ(it != set.end(), expected.count(k) != 0);
+      if (it != set.end()) set.erase(it);
+      auto victim = expected.find(k);
+      if (victim != expected.end()) expected.erase(victim);
+    } else {
+      set.insert(k);
+      expected.insert(k);
+    }
+    ASSERT_EQ(set.count(k), expected.count(k));
+  }
+  ASSERT_EQ(set.size(), expected.size());
+  std::multiset<std::string> all;
+  for (const auto &k : set) all.insert(k);
+  EXPECT_EQ(all, expected);
+}
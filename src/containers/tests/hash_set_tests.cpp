@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <set>
+#include <string>
+#include <unordered_set>
+
+#include "../set/s21_hash_set.h"
+
+class HashSetTests : public ::testing::Test {
+ protected:
+  void SetUp() override {}
+  void TearDown() override {}
+};
+
+template <typename SetType>
+std::set<int> to_std_set(const SetType &set) {
+  std::set<int> result;
+  for (int key : set) EXPECT_TRUE(result.insert(key).second);
+  return result;
+}
+
+TEST_F(HashSetTests, SetInterface) {
+  s21::HashSet<int> set = {5, 1, 3, 1, -2};
+  EXPECT_EQ(set.size(), 4u);
+  EXPECT_FALSE(set.empty());
+  EXPECT_TRUE(set.contains(3));
+  EXPECT_FALSE(set.contains(4));
+  EXPECT_EQ(*set.find(5), 5);
+  EXPECT_EQ(set.find(4), set.end());
+
+  auto result = set.insert(3);
+  EXPECT_FALSE(result.second);
+  EXPECT_EQ(*result.first, 3);
+  result = set.insert(4);
+  EXPECT_TRUE(result.second);
+  EXPECT_EQ(*result.first, 4);
+
+  auto inserted = set.insert_many(7, 1, 8);
+  EXPECT_TRUE(inserted[0].second);
+  EXPECT_FALSE(inserted[1].second);
+  EXPECT_EQ(*inserted[2].first, 8);
+
+  set.erase(set.find(1));
+  set.erase(set.end());
+  EXPECT_EQ(to_std_set(set), (std::set<int>{-2, 3, 4, 5, 7, 8}));
+  set.clear();
+  EXPECT_TRUE(set.empty());
+  EXPECT_EQ(set.begin(), set.end());
+}
+
+TEST_F(HashSetTests, CopyMoveSwapMerge) {
+  s21::HashSet<int> set;
+  for (int i = 0; i < 100; ++i) set.insert(i);
+  s21::HashSet<int> copy(set);
+  s21::HashSet<int> moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(moved.size(), 100u);
+
+  s21::HashSet<int> other;
+  for (int i = 50; i < 150; ++i) other.insert(i);
+  set.merge(other);
+  EXPECT_EQ(set.size(), 150u);
+  // Как у s21::Set: ключи копируются, other не меняется
+  EXPECT_EQ(other.size(), 100u);
+  EXPECT_TRUE(other.contains(50));
+  EXPECT_TRUE(other.contains(100));
+
+  set.swap(other);
+  EXPECT_EQ(set.size(), 100u);
+  EXPECT_EQ(other.size(), 150u);
+  moved = other;
+  EXPECT_EQ(to_std_set(moved), to_std_set(other));
+}
+
+TEST_F(HashSetTests, RandomOperationsMatchUnorderedSet) {
+  std::mt19937 gen(7);
+  std::uniform_int_distribution<int> key(0, 2000);
+  s21::HashSet<std::string> set;
+  std::unordered_set<std::string> expected;
+  for (int step = 0; step < 30000; ++step) {
+    std::string k = std::to_string(key(gen));
+    if (step % 2 == 0) {
+      auto it = set.find(k);
+      EXPECT_EQ(it != set.end(), expected.count(k) == 1);
+      if (it != set.end()) set.erase(it);
+      expected.erase(k);
+    } else {
+      EXPECT_EQ(set.insert(k).second, expected.insert(k).second);
+    }
+  }
+  ASSERT_EQ(set.size(), expected.size());
+  for (const auto &k : expected) EXPECT_TRUE(set.contains(k));
+}
@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "../list/s21_intrusive_list.h"
+
+namespace {
+struct Task {
+  explicit Task(int id) : id(id) {}
+
+  int id;
+  std::string name = "task";
+  s21::IntrusiveListHook by_queue;
+  s21::IntrusiveListHook by_owner;
+};
+
+using QueueList = s21::IntrusiveList<Task, &Task::by_queue>;
+using OwnerList = s21::IntrusiveList<Task, &Task::by_owner>;
+
+template <typename ListType>
+std::vector<int> ids(const ListType &list) {
+  std::vector<int> result;
+  for (auto it = list.cbegin(); it != list.cend(); ++it) {
+    result.push_back(it->id);
+  }
+  return result;
+}
+}  // namespace
+
+class IntrusiveListTests : public ::testing::Test {
+ protected:
+  std::vector<Task> tasks{Task(0), Task(1), Task(2), Task(3), Task(4)};
+};
+
+TEST_F(IntrusiveListTests, pushPopIterate) {
+  QueueList queue;
+  EXPECT_TRUE(queue.empty());
+  EXPECT_TRUE(queue.begin() == queue.end());
+  for (int i = 0; i < 4; ++i) queue.push_back(tasks[i]);
+  queue.push_front(tasks[4]);
+  EXPECT_EQ(ids(queue), (std::vector<int>{4, 0, 1, 2, 3}));
+  EXPECT_EQ(queue.size(), 5u);
+  EXPECT_EQ(&queue.front(), &tasks[4]);
+  EXPECT_EQ(&queue.back(), &tasks[3]);
+
+  queue.erase(--queue.end());
+  queue.pop_front();
+  queue.pop_back();
+  EXPECT_EQ(ids(queue), (std::vector<int>{0, 1}));
+  EXPECT_FALSE(tasks[4].by_queue.is_linked());
+  EXPECT_FALSE(tasks[3].by_queue.is_linked());
+  EXPECT_TRUE(tasks[0].by_queue.is_linked());
+  queue.clear();
+  EXPECT_FALSE(tasks[0].by_queue.is_linked());
+}
+
+TEST_F(IntrusiveListTests, twoMembershipsWithoutCopies) {
+  QueueList queue;
+  OwnerList owner;
+  for (Task &task : tasks) queue.push_back(task);
+  for (auto it = tasks.rbegin(); it != tasks.rend(); ++it) {
+    owner.push_back(*it);
+  }
+  EXPECT_EQ(ids(queue), (std::vector<int>{0, 1, 2, 3, 4}));
+  EXPECT_EQ(ids(owner), (std::vector<int>{4, 3, 2, 1, 0}));
+
+  // Удаление по ссылке на объект, без поиска
+  auto next = queue.erase(tasks[2]);
+  EXPECT_EQ(next->id, 3);
+  EXPECT_EQ(ids(queue), (std::vector<int>{0, 1, 3, 4}));
+  EXPECT_EQ(ids(owner), (std::vector<int>{4, 3, 2, 1, 0}));
+  EXPECT_EQ(&*QueueList::iterator_to(tasks[3]), &tasks[3]);
+
+  tasks[1].name = "renamed";
+  EXPECT_EQ((++queue.begin())->name, "renamed");
+
+  Task copy = tasks[0];
+  EXPECT_FALSE(copy.by_queue.is_linked());
+  queue.clear();
+  owner.clear();
+}
+
+TEST_F(IntrusiveListTests, spliceMoveSwapReverse) {
+  QueueList a;
+  QueueList b;
+  a.push_back(tasks[0]);
+  a.push_back(tasks[1]);
+  b.push_back(tasks[2]);
+  b.push_back(tasks[3]);
+  b.push_back(tasks[4]);
+
+  a.splice(++a.cbegin(), b, b.cbegin());
+  EXPECT_EQ(ids(a), (std::vector<int>{0, 2, 1}));
+  EXPECT_EQ(b.size(), 2u);
+  a.splice(a.cend(), b);
+  EXPECT_TRUE(b.empty());
+  EXPECT_EQ(ids(a), (std::vector<int>{0, 2, 1, 3, 4}));
+
+  auto first = ++a.cbegin();
+  auto last = first;
+  ++last;
+  ++last;
+  b.splice(b.cend(), a, first, last);
+  EXPECT_EQ(ids(a), (std::vector<int>{0, 3, 4}));
+  EXPECT_EQ(ids(b), (std::vector<int>{2, 1}));
+
+  a.reverse();
+  EXPECT_EQ(ids(a), (std::vector<int>{4, 3, 0}));
+  a.swap(b);
+  EXPECT_EQ(ids(a), (std::vector<int>{2, 1}));
+  EXPECT_EQ(ids(b), (std::vector<int>{4, 3, 0}));
+
+  QueueList c(std::move(b));
+  EXPECT_TRUE(b.empty());
+  EXPECT_EQ(ids(c), (std::vector<int>{4, 3, 0}));
+  EXPECT_EQ(&c.back(), &tasks[0]);
+  {
+    QueueList scoped;
+    scoped.splice(scoped.cend(), c);
+  }
+  EXPECT_FALSE(tasks[4].by_queue.is_linked());
+  a.clear();
+}
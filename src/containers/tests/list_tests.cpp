@@ -1,7 +1,11 @@
 #include <gtest/gtest.h>
 
+#include <functional>
 #include <iostream>
 #include <list>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include "../list/s21_list.h"
 
@@ -188,5 +192,258 @@ TEST_F(ListsTests, low_test23) {
   auto it = a.begin();
   auto it1 = a.end();
   EXPECT_TRUE(*it);
-  EXPECT_TRUE(it1 == nullptr);
-}
\ No newline at end of file
+  EXPECT_TRUE(it1 == a.cend());
+  --it1;
+  EXPECT_TRUE(it1 == it);
+}
+TEST_F(ListsTests, sortRelinksNodes) {
+  s21::List<int> a{5, 3, 9, 1, 7, 3, 8, 2, 6};
+  std::vector<int *> addresses;
+  for (auto it = a.begin(); it != a.end(); ++it) addresses.push_back(&*it);
+  a.sort();
+  std::vector<int> expected{1, 2, 3, 3, 5, 6, 7, 8, 9};
+  std::size_t i = 0;
+  for (auto it = a.begin(); it != a.end(); ++it, ++i) {
+    EXPECT_EQ(*it, expected[i]);
+    EXPECT_NE(std::find(addresses.begin(), addresses.end(), &*it),
+              addresses.end());
+  }
+  EXPECT_EQ(i, a.size());
+  EXPECT_EQ(a.front(), 1);
+  EXPECT_EQ(a.back(), 9);
+  auto it = a.begin();
+  ++it;
+  --it;
+  EXPECT_EQ(*it, 1);
+}
+
+TEST_F(ListsTests, sortComparatorStable) {
+  s21::List<std::pair<int, int>> a{{2, 0}, {1, 1}, {2, 2}, {1, 3}, {0, 4}};
+  a.sort([](const std::pair<int, int> &l, const std::pair<int, int> &r) {
+    return l.first > r.first;
+  });
+  std::vector<std::pair<int, int>> expected{
+      {2, 0}, {2, 2}, {1, 1}, {1, 3}, {0, 4}};
+  std::size_t i = 0;
+  for (auto it = a.begin(); it != a.end(); ++it, ++i) {
+    EXPECT_EQ(*it, expected[i]);
+  }
+}
+
+TEST_F(ListsTests, mergeSorted) {
+  s21::List<int> a{1, 3, 5, 7};
+  s21::List<int> b{2, 3, 6, 8, 10};
+  a.merge(b);
+  EXPECT_TRUE(b.empty());
+  EXPECT_EQ(a.size(), 9u);
+  std::vector<int> expected{1, 2, 3, 3, 5, 6, 7, 8, 10};
+  std::size_t i = 0;
+  for (auto it = a.begin(); it != a.end(); ++it, ++i) {
+    EXPECT_EQ(*it, expected[i]);
+  }
+  EXPECT_EQ(a.back(), 10);
+  a.push_back(11);
+  EXPECT_EQ(a.back(), 11);
+
+  s21::List<int> c;
+  c.merge(a);
+  EXPECT_EQ(c.size(), 10u);
+  EXPECT_TRUE(a.empty());
+}
+
+TEST_F(ListsTests, mergeKeepsAddresses) {
+  // merge перецепляет узлы: элементы обоих списков остаются на своих местах
+  s21::List<std::string> a{"a", "c", "e"};
+  s21::List<std::string> b{"b", "d", "f"};
+  std::vector<const std::string *> expected;
+  auto left = a.begin();
+  auto right = b.begin();
+  for (int i = 0; i < 3; ++i, ++left, ++right) {
+    expected.push_back(&*left);
+    expected.push_back(&*right);
+  }
+  a.merge(b);
+  EXPECT_TRUE(b.empty());
+  std::size_t i = 0;
+  for (auto it = a.begin(); it != a.end(); ++it, ++i) {
+    EXPECT_EQ(&*it, expected[i]);
+  }
+  EXPECT_EQ(i, 6u);
+}
+
+TEST_F(ListsTests, spliceStealsNodes) {
+  s21::List<int> a{1, 5};
+  s21::List<int> b{2, 3, 4};
+  const int *moved = &b.front();
+  a.splice(++a.cbegin(), b);
+  // Узлы перецепляются, а не копируются
+  EXPECT_EQ(&*(++a.begin()), moved);
+  EXPECT_TRUE(b.empty());
+  EXPECT_EQ(a.size(), 5u);
+  int expected = 1;
+  for (auto it = a.begin(); it != a.end(); ++it) EXPECT_EQ(*it, expected++);
+  EXPECT_EQ(a.back(), 5);
+
+  // Пустой список забирает узлы вместе с пулом, не перевыделяя их
+  s21::List<int> c;
+  moved = &a.front();
+  c.splice(c.cbegin(), a);
+  EXPECT_EQ(&c.front(), moved);
+  EXPECT_EQ(c.size(), 5u);
+  EXPECT_EQ(c.front(), 1);
+  EXPECT_EQ(c.back(), 5);
+  a.push_back(7);
+  EXPECT_EQ(a.front(), 7);
+}
+
+TEST_F(ListsTests, spliceElementAndRange) {
+  s21::List<int> a{1, 2, 3, 4, 5};
+  s21::List<int> b{10, 20};
+
+  const int *one = &a.front();
+  b.splice(b.cbegin(), a, a.cbegin());
+  EXPECT_EQ(&b.front(), one);
+  EXPECT_EQ(a.size(), 4u);
+  EXPECT_EQ(a.front(), 2);
+  EXPECT_EQ(b.size(), 3u);
+  EXPECT_EQ(b.front(), 1);
+
+  auto first = ++a.cbegin();
+  const int *five = &a.back();
+  b.splice(++b.cbegin(), a, first, a.cend());
+  EXPECT_EQ(&*(--(--(--b.end()))), five);
+  EXPECT_EQ(a.size(), 1u);
+  EXPECT_EQ(a.back(), 2);
+  std::vector<int> expected{1, 3, 4, 5, 10, 20};
+  std::size_t i = 0;
+  for (auto it = b.begin(); it != b.end(); ++it, ++i) {
+    EXPECT_EQ(*it, expected[i]);
+  }
+  EXPECT_EQ(i, b.size());
+
+  // Перенос внутри одного списка: хвост в начало
+  auto tail = b.cbegin();
+  ++tail;
+  ++tail;
+  ++tail;
+  ++tail;
+  b.splice(b.cbegin(), b, tail, b.cend());
+  expected = {10, 20, 1, 3, 4, 5};
+  i = 0;
+  for (auto it = b.begin(); it != b.end(); ++it, ++i) {
+    EXPECT_EQ(*it, expected[i]);
+  }
+  EXPECT_EQ(b.size(), 6u);
+  EXPECT_EQ(b.back(), 5);
+}
+
+TEST_F(ListsTests, poolRecyclesNodes) {
+  s21::List<int> a{1, 2, 3};
+  const int *freed = &a.back();
+  a.pop_back();
+  a.push_front(0);
+  EXPECT_EQ(&a.front(), freed);
+
+  a.clear();
+  EXPECT_TRUE(a.empty());
+  a.push_back(4);
+  a.push_back(5);
+  EXPECT_EQ(a.front(), 4);
+  EXPECT_EQ(a.back(), 5);
+}
+
+TEST_F(ListsTests, poolSurvivesSplicedSource) {
+  s21::List<std::string> a{"a", "b"};
+  {
+    s21::List<std::string> b{"c: long string that does not fit inline", "d"};
+    s21::List<std::string> c{"e"};
+    a.splice(a.cend(), b, b.cbegin());
+    c.splice(c.cbegin(), b);
+    a.merge(c);
+    b.push_back("f");
+    a.splice(a.cbegin(), b);
+  }
+  std::vector<std::string> expected{
+      "f", "a", "b", "c: long string that does not fit inline", "d", "e"};
+  std::size_t i = 0;
+  for (auto it = a.begin(); it != a.end(); ++it, ++i) {
+    EXPECT_EQ(*it, expected[i]);
+  }
+  EXPECT_EQ(i, a.size());
+  a.pop_front();
+  a.push_back("g");
+  EXPECT_EQ(a.back(), "g");
+  a.clear();
+  EXPECT_TRUE(a.empty());
+}
+
+TEST_F(ListsTests, splicedListsShareLockedPool) {
+  // После splice и merge списки делят один пул, который защищён мьютексом,
+  // поэтому разные списки по-прежнему можно менять из разных потоков
+  s21::List<int> a{1, 3};
+  s21::List<int> b{2, 4, 5};
+  a.splice(a.cend(), b, b.cbegin());
+  a.merge(b);
+  b.push_back(6);
+  auto churn = [](s21::List<int> &list) {
+    for (int i = 0; i < 100000; ++i) {
+      list.push_back(i);
+      list.pop_front();
+    }
+  };
+  std::thread other(churn, std::ref(b));
+  churn(a);
+  other.join();
+  EXPECT_EQ(a.size(), 5u);
+  EXPECT_EQ(b.size(), 1u);
+  EXPECT_EQ(b.front(), 99999);
+}
+
+TEST_F(ListsTests, sentinelEnd) {
+  s21::List<int> a;
+  EXPECT_TRUE(a.begin() == a.end());
+  a.pop_back();
+  a.pop_front();
+  EXPECT_TRUE(a.empty());
+
+  a.push_back(2);
+  a.push_front(1);
+  a.push_back(3);
+  std::vector<int> backwards;
+  auto it = a.end();
+  do {
+    --it;
+    backwards.push_back(*it);
+  } while (it != a.begin());
+  EXPECT_EQ(backwards, (std::vector<int>{3, 2, 1}));
+
+  auto next = a.erase(--a.cend());
+  EXPECT_TRUE(next == a.end());
+  a.insert(a.cend(), 4);
+  EXPECT_EQ(a.back(), 4);
+
+  a.reverse();
+  EXPECT_EQ(a.front(), 4);
+  EXPECT_EQ(*--a.end(), 1);
+
+  s21::List<int> b{7, 8};
+  a.swap(b);
+  EXPECT_EQ(*--a.end(), 8);
+  EXPECT_EQ(*--b.end(), 1);
+  s21::List<int> c(std::move(a));
+  EXPECT_TRUE(a.begin() == a.end());
+  EXPECT_EQ(*--c.end(), 8);
+  EXPECT_EQ(*++c.end(), 7);
+}
+
+TEST_F(ListsTests, uniqueRuns) {
+  s21::List<int> a{2, 2, 2, 1, 1, 0, 0, 0, 5};
+  a.unique();
+  std::vector<int> expected{2, 1, 0, 5};
+  std::size_t i = 0;
+  for (auto it = a.begin(); it != a.end(); ++it, ++i) {
+    EXPECT_EQ(*it, expected[i]);
+  }
+  EXPECT_EQ(a.size(), 4u);
+  EXPECT_EQ(a.back(), 5);
+}
@@ -218,4 +218,29 @@ TEST(BinaryTreeMapTests, throw_test) {
   s21::BinaryTreeMap<int, int>::ConstSetIterator kj =
       s21::BinaryTreeMap<int, int>::ConstSetIterator(nullptr);
   EXPECT_EQ(map.cbegin(), kj);
-}
\ No newline at end of file
+}
+TEST(BinaryTreeMapTests, SortedInsertEraseTest) {
+  s21::BinaryTreeMap<int, int> map;
+  const int n = 100000;
+  for (int i = 0; i < n; ++i) {
+    map.insert(i, i * 2);
+  }
+  EXPECT_EQ(map.size(), static_cast<std::size_t>(n));
+  EXPECT_EQ(map.at(n - 1), (n - 1) * 2);
+
+  for (int i = 0; i < n / 2; ++i) {
+    map.erase(map.begin());
+    ++map[n - 1 - i];
+  }
+  EXPECT_EQ(map.size(), static_cast<std::size_t>(n / 2));
+  EXPECT_FALSE(map.contains(n / 2 - 1));
+  EXPECT_TRUE(map.contains(n / 2));
+
+  int expected = n / 2;
+  for (auto it = map.begin(); it != map.end(); ++it) {
+    EXPECT_EQ((*it).first, expected);
+    EXPECT_EQ((*it).second, expected * 2 + 1);
+    ++expected;
+  }
+  EXPECT_EQ(expected, n);
+}
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../queue/s21_mpmc_queue.h"
+
+class MpmcQueueTests : public ::testing::Test {
+ protected:
+  void SetUp() override {}
+  void TearDown() override {}
+};
+
+TEST_F(MpmcQueueTests, boundedFifo) {
+  s21::MpmcQueue<int> queue(3);
+  EXPECT_EQ(queue.capacity(), 4u);
+  EXPECT_TRUE(queue.empty());
+  for (int i = 0; i < 4; ++i) EXPECT_TRUE(queue.try_push(i));
+  EXPECT_FALSE(queue.try_push(4));
+  EXPECT_EQ(queue.size(), 4u);
+
+  int value = -1;
+  for (int round = 0; round < 10; ++round) {
+    EXPECT_TRUE(queue.try_pop(value));
+    EXPECT_EQ(value, round);
+    EXPECT_TRUE(queue.try_push(round + 4));
+  }
+  for (int expected = 10; expected < 14; ++expected) {
+    queue.pop(value);
+    EXPECT_EQ(value, expected);
+  }
+  EXPECT_FALSE(queue.try_pop(value));
+  EXPECT_THROW(s21::MpmcQueue<int>(1), std::invalid_argument);
+}
+
+TEST_F(MpmcQueueTests, destroysRemainingItems) {
+  s21::MpmcQueue<std::shared_ptr<std::string>> queue(4);
+  auto shared = std::make_shared<std::string>("payload");
+  queue.push(shared);
+  EXPECT_TRUE(queue.try_emplace(shared));
+  std::shared_ptr<std::string> out;
+  EXPECT_TRUE(queue.try_pop(out));
+  EXPECT_EQ(shared.use_count(), 3);
+  out.reset();
+  EXPECT_EQ(shared.use_count(), 2);
+}
+
+TEST_F(MpmcQueueTests, throwingCopyKeepsQueueUsable) {
+  // Копирование бросает, перемещение нет
+  struct Fragile {
+    int value = 0;
+    Fragile(int v) : value(v) {}
+    Fragile(const Fragile &other) : value(other.value) {
+      if (value < 0) throw std::runtime_error("copy failed");
+    }
+    Fragile(Fragile &&) noexcept = default;
+    Fragile &operator=(Fragile &&) noexcept = default;
+  };
+
+  s21::MpmcQueue<Fragile> queue(2);
+  const Fragile bad(-1);
+  EXPECT_THROW(queue.try_push(bad), std::runtime_error);
+  EXPECT_THROW(queue.push(bad), std::runtime_error);
+  EXPECT_TRUE(queue.empty());
+  EXPECT_TRUE(queue.try_push(Fragile(1)));
+  EXPECT_TRUE(queue.try_emplace(2));
+  Fragile out(0);
+  EXPECT_TRUE(queue.try_pop(out));
+  EXPECT_EQ(out.value, 1);
+  EXPECT_TRUE(queue.try_pop(out));
+  EXPECT_EQ(out.value, 2);
+  EXPECT_FALSE(queue.try_pop(out));
+}
+
+TEST_F(MpmcQueueTests, producersConsumersLoseNothing) {
+  const int producers = 4;
+  const int consumers = 3;
+  const int per_producer = 20000;
+  const int total = producers * per_producer;
+  s21::MpmcQueue<int> queue(64);
+  std::vector<std::atomic<int>> seen(total);
+  for (auto &count : seen) count.store(0);
+  std::atomic<int> consumed{0};
+
+  std::vector<std::thread> threads;
+  for (int p = 0; p < producers; ++p) {
+    threads.emplace_back([&, p] {
+      for (int i = 0; i < per_producer; ++i) queue.push(p * per_producer + i);
+    });
+  }
+  for (int c = 0; c < consumers; ++c) {
+    threads.emplace_back([&] {
+      int value;
+      while (consumed.load() < total) {
+        if (queue.try_pop(value)) {
+          seen[value].fetch_add(1);
+          consumed.fetch_add(1);
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+
+  int lost = 0;
+  int duplicated = 0;
+  for (auto &count : seen) {
+    lost += count.load() == 0;
+    duplicated += count.load() > 1;
+  }
+  EXPECT_EQ(lost, 0);
+  EXPECT_EQ(duplicated, 0);
+  EXPECT_EQ(consumed.load(), total);
+  EXPECT_TRUE(queue.empty());
+}
@@ -237,4 +237,37 @@ TEST_F(MultisetTest, notFind) {
   // std::multiset<int> set2;
   s21::Multiset<int>::iterator it = set1.find(1);
   EXPECT_TRUE(it == nullptr);
-}
\ No newline at end of file
+}
+TEST_F(MultisetTest, equalRangeTest) {
+  s21::Multiset<int> set1 = {5, 1, 3, 3, 3, 7, 9};
+  auto range = set1.equal_range(3);
+  int n = 0;
+  for (auto it = range.first; it != range.second; ++it) {
+    EXPECT_EQ(*it, 3);
+    ++n;
+  }
+  EXPECT_EQ(n, 3);
+  EXPECT_EQ(*set1.upper_bound(3), 5);
+  EXPECT_EQ(*set1.lower_bound(4), 5);
+  EXPECT_EQ(set1.lower_bound(10), set1.end());
+  EXPECT_EQ(set1.upper_bound(9), set1.end());
+
+  auto empty = set1.equal_range(4);
+  EXPECT_EQ(empty.first, empty.second);
+}
+
+TEST_F(MultisetTest, countAfterEraseTest) {
+  s21::Multiset<int> set1 = {5, 3, 8, 7, 7, 9};
+  EXPECT_EQ(set1.count(7), 2u);
+  EXPECT_EQ(set1.count(4), 0u);
+  set1.erase(set1.find(5));
+  EXPECT_FALSE(set1.contains(5));
+  EXPECT_EQ(set1.count(7), 2u);
+  set1.erase(set1.find(7));
+  EXPECT_EQ(set1.count(7), 1u);
+  set1.erase(set1.find(7));
+  EXPECT_EQ(set1.count(7), 0u);
+  EXPECT_EQ(set1.size(), 3u);
+  EXPECT_EQ(*set1.begin(), 3);
+  EXPECT_EQ(*set1.upper_bound(3), 8);
+}
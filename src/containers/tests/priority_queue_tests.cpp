@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <memory>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../queue/s21_priority_queue.h"
+
+class PriorityQueueTests : public ::testing::Test {
+ protected:
+  void SetUp() override {}
+  void TearDown() override {}
+};
+
+template <typename Queue>
+std::vector<int> drain(Queue &queue) {
+  std::vector<int> out;
+  while (!queue.empty()) {
+    out.push_back(queue.top());
+    queue.pop();
+  }
+  return out;
+}
+
+template <std::size_t Arity>
+void check_against_std(unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> value(0, 500);
+  s21::PriorityQueue<int, s21::Vector<int>, std::less<int>, Arity> queue;
+  std::priority_queue<int> expected;
+  for (int i = 0; i < 2000; ++i) {
+    if (i % 3 == 2) {
+      ASSERT_EQ(queue.top(), expected.top());
+      queue.pop();
+      expected.pop();
+    } else {
+      int v = value(gen);
+      queue.push(v);
+      expected.push(v);
+    }
+    ASSERT_EQ(queue.size(), expected.size());
+  }
+  while (!expected.empty()) {
+    ASSERT_EQ(queue.top(), expected.top());
+    queue.pop();
+    expected.pop();
+  }
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST_F(PriorityQueueTests, MatchesStdForEachArity) {
+  check_against_std<2>(1);
+  check_against_std<3>(2);
+  check_against_std<4>(3);
+  check_against_std<8>(4);
+}
+
+TEST_F(PriorityQueueTests, HeapifyFromRange) {
+  std::vector<int> items{5, 1, 9, 3, 7, 9, 2, 8, 0, 6, 4};
+  s21::PriorityQueue<int> queue(items.begin(), items.end());
+  EXPECT_EQ(queue.size(), items.size());
+  EXPECT_EQ(drain(queue),
+            (std::vector<int>{9, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0}));
+
+  s21::PriorityQueue<int, s21::Vector<int>, std::greater<int>, 3> min_queue{
+      4, 2, 6, 1, 5};
+  EXPECT_EQ(drain(min_queue), (std::vector<int>{1, 2, 4, 5, 6}));
+
+  s21::PriorityQueue<int> adopted(std::less<int>(),
+                                  s21::Vector<int>{3, 1, 2});
+  EXPECT_EQ(adopted.top(), 3);
+}
+
+TEST_F(PriorityQueueTests, InsertManyBack) {
+  s21::PriorityQueue<int> queue;
+  queue.insert_many_back(3, 8, 1);  // перестройка всей кучи
+  queue.insert_many_back(5);        // просеивание нового элемента
+  queue.insert_many_back(0, 9);
+  EXPECT_EQ(drain(queue), (std::vector<int>{9, 8, 5, 3, 1, 0}));
+  queue.pop();
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST_F(PriorityQueueTests, EmplaceAndMoveOnly) {
+  s21::PriorityQueue<std::string> strings;
+  strings.emplace(3, 'b');
+  strings.emplace("abc");
+  strings.push(std::string("c"));
+  EXPECT_EQ(strings.top(), "c");
+  strings.pop();
+  EXPECT_EQ(strings.top(), "bbb");
+
+  auto by_value = [](const std::unique_ptr<int> &a,
+                     const std::unique_ptr<int> &b) { return *a < *b; };
+  s21::PriorityQueue<std::unique_ptr<int>, s21::Vector<std::unique_ptr<int>>,
+                     decltype(by_value)>
+      pointers(by_value);
+  for (int v : {4, 7, 1}) pointers.push(std::make_unique<int>(v));
+  EXPECT_EQ(*pointers.top(), 7);
+  pointers.pop();
+  EXPECT_EQ(*pointers.top(), 4);
+}
+
+TEST_F(PriorityQueueTests, CopyAndSwap) {
+  s21::PriorityQueue<int> first{1, 5, 3};
+  s21::PriorityQueue<int> second{2};
+  s21::PriorityQueue<int> copy(first);
+  first.swap(second);
+  EXPECT_EQ(first.top(), 2);
+  EXPECT_EQ(second.top(), 5);
+  EXPECT_EQ(drain(copy), (std::vector<int>{5, 3, 1}));
+  EXPECT_EQ(second.size(), 3u);
+}
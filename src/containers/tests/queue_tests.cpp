@@ -1,5 +1,9 @@
 #include <gtest/gtest.h>
 
+#include <memory>
+#include <string>
+
+#include "../list/s21_list.h"
 #include "../queue/s21_queue.h"
 
 class QueueTests : public ::testing::Test {
@@ -92,4 +96,32 @@ TEST_F(QueueTests, InsertManyBack) {
   for (int i = 0; i < 6; ++i) {
     EXPECT_EQ(queue.front(), queue_expected.front());
   }
-}
\ No newline at end of file
+}
+TEST_F(QueueTests, ListBackedQueue) {
+  s21::Queue<int, s21::List<int>> queue{1, 2, 3};
+  queue.push(4);
+  queue.pop();
+  queue.insert_many_back(5, 6);
+  EXPECT_EQ(queue.front(), 2);
+  EXPECT_EQ(queue.back(), 6);
+  EXPECT_EQ(queue.size(), 5u);
+}
+
+TEST_F(QueueTests, InsertManyBackForwards) {
+  // Аргументы передаются контейнеру напрямую, без копии в initializer_list
+  s21::Queue<std::unique_ptr<int>> queue;
+  queue.insert_many_back(std::make_unique<int>(1), std::make_unique<int>(2));
+  EXPECT_EQ(queue.size(), 2u);
+  EXPECT_EQ(*queue.front(), 1);
+  EXPECT_EQ(*queue.back(), 2);
+}
+
+TEST_F(QueueTests, PushMovesValue) {
+  s21::Queue<std::string> queue;
+  std::string value(64, 'x');
+  queue.push(std::move(value));
+  EXPECT_EQ(queue.front(), std::string(64, 'x'));
+  s21::Queue<std::string, s21::List<std::string>> list_queue;
+  list_queue.push(std::string("copy"));
+  EXPECT_EQ(list_queue.front(), "copy");
+}
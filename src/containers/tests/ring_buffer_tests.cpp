@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+#include "../queue/s21_ring_buffer.h"
+
+class RingBufferTests : public ::testing::Test {
+ protected:
+  void SetUp() override {}
+  void TearDown() override {}
+};
+
+TEST_F(RingBufferTests, wrapAroundAndGrow) {
+  s21::RingBuffer<int> ring;
+  EXPECT_TRUE(ring.empty());
+  EXPECT_EQ(ring.capacity(), 0u);
+  for (int i = 0; i < 4; ++i) ring.push_back(i);
+  EXPECT_EQ(ring.capacity(), 4u);
+
+  // Голова уходит вперёд, хвост заворачивает в начало блока
+  ring.pop_front();
+  ring.pop_front();
+  ring.push_back(4);
+  ring.push_back(5);
+  EXPECT_EQ(ring.capacity(), 4u);
+  EXPECT_EQ(ring.front(), 2);
+  EXPECT_EQ(ring.back(), 5);
+
+  // Рост из завёрнутого состояния сохраняет порядок
+  ring.push_back(6);
+  EXPECT_EQ(ring.capacity(), 8u);
+  ASSERT_EQ(ring.size(), 5u);
+  for (std::size_t i = 0; i < ring.size(); ++i) {
+    EXPECT_EQ(ring[i], static_cast<int>(i) + 2);
+  }
+  EXPECT_THROW(ring.at(5), std::out_of_range);
+  ring.pop_back();
+  EXPECT_EQ(ring.back(), 5);
+}
+
+TEST_F(RingBufferTests, copyMoveSwap) {
+  s21::RingBuffer<std::string> a{"a", "b", "c"};
+  a.pop_front();
+  a.push_back("long string that is allocated on the heap");
+  s21::RingBuffer<std::string> b(a);
+  EXPECT_EQ(b.size(), 3u);
+  EXPECT_EQ(b.front(), "b");
+  EXPECT_EQ(b.back(), "long string that is allocated on the heap");
+
+  s21::RingBuffer<std::string> c(std::move(a));
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(c.front(), "b");
+  a = c;
+  c.clear();
+  EXPECT_TRUE(c.empty());
+  c.insert_many_back("x", "y");
+  a.swap(c);
+  EXPECT_EQ(a.front(), "x");
+  EXPECT_EQ(c.size(), 3u);
+  c = std::move(a);
+  EXPECT_EQ(c.back(), "y");
+}
+
+TEST_F(RingBufferTests, moveOnlyAndSelfReference) {
+  s21::RingBuffer<std::unique_ptr<int>> owners;
+  for (int i = 0; i < 5; ++i) owners.push_back(std::make_unique<int>(i));
+  EXPECT_EQ(*owners.front(), 0);
+  EXPECT_EQ(*owners.back(), 4);
+
+  s21::RingBuffer<std::string> ring{"first", "second"};
+  ring.push_back(ring.front());
+  ring.push_back(ring.front());
+  EXPECT_EQ(ring.size(), 4u);
+  EXPECT_EQ(ring.back(), "first");
+  ring.reserve(100);
+  EXPECT_EQ(ring.capacity(), 128u);
+  EXPECT_EQ(ring[1], "second");
+}
+
+TEST_F(RingBufferTests, insertManyBackAliasesElements) {
+  // Аргументы ссылаются на элементы заполненного буфера, который растёт
+  const std::string a(40, 'a');
+  const std::string b(40, 'b');
+  s21::RingBuffer<std::string> ring{a, b, a, b};
+  ring.pop_front();
+  ring.push_back(a);
+  ASSERT_EQ(ring.size(), ring.capacity());
+  ring.insert_many_back(ring[0], ring[1]);
+  EXPECT_EQ(ring.size(), 6u);
+  EXPECT_EQ(ring[4], b);
+  EXPECT_EQ(ring[5], a);
+  EXPECT_EQ(ring[0], b);
+  EXPECT_EQ(ring.back(), a);
+}
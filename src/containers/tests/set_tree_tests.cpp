@@ -248,4 +248,32 @@ TEST_F(BinaryTreeTestSet, others) {
   ++it2;
   ++it2;
   tree1.erase(it2);
-}
\ No newline at end of file
+}
+TEST_F(BinaryTreeTestSet, FindTest) {
+  for (auto key : original) {
+    s21::BinaryTree<int>::iterator it = tree.find(key);
+    EXPECT_NE(it, tree.end());
+    EXPECT_EQ(*it, key);
+    EXPECT_TRUE(tree.contains(key));
+  }
+  EXPECT_EQ(tree.find(0), tree.end());
+  EXPECT_EQ(tree.find(100), tree.end());
+  EXPECT_FALSE(tree.contains(-100));
+
+  s21::BinaryTree<int>::iterator it = tree.find(4);
+  ++it;
+  EXPECT_EQ(*it, 5);
+}
+
+TEST_F(BinaryTreeTestSet, InsertReturnTest) {
+  auto result = tree.insert(2);
+  EXPECT_TRUE(result.second);
+  EXPECT_EQ(*result.first, 2);
+  EXPECT_EQ(*(++result.first), 4);
+  EXPECT_EQ(tree.size(), original.size() + 1);
+
+  result = tree.insert(5);
+  EXPECT_FALSE(result.second);
+  EXPECT_EQ(result.first, tree.find(5));
+  EXPECT_EQ(tree.size(), original.size() + 1);
+}
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+#include "../stack/s21_stack.h"
+#include "../vector/s21_small_vector.h"
+
+class SmallVectorTests : public ::testing::Test {
+ protected:
+  void SetUp() override {}
+
+  void TearDown() override {}
+};
+
+TEST_F(SmallVectorTests, staysInline) {
+  s21::SmallVector<int, 8> a;
+  EXPECT_TRUE(a.is_inline());
+  EXPECT_EQ(a.capacity(), 8u);
+  for (int i = 0; i < 8; ++i) a.push_back(i);
+  EXPECT_TRUE(a.is_inline());
+  EXPECT_EQ(a.at(7), 7);
+  EXPECT_THROW(a.at(8), std::out_of_range);
+}
+
+TEST_F(SmallVectorTests, spillsToHeap) {
+  s21::SmallVector<int, 4> a{1, 2, 3};
+  a.insert_many_back(4, 5, 6);
+  EXPECT_FALSE(a.is_inline());
+  EXPECT_EQ(a.size(), 6u);
+  EXPECT_EQ(a.back(), 6);
+  a.erase(a.begin());
+  a.pop_back();
+  a.shrink_to_fit();
+  EXPECT_TRUE(a.is_inline());
+  EXPECT_EQ(a.front(), 2);
+  EXPECT_EQ(a[3], 5);
+}
+
+TEST_F(SmallVectorTests, insertAndEmplace) {
+  s21::SmallVector<std::string, 2> a;
+  a.emplace_back(2, 'a');
+  a.insert(a.begin(), "first");
+  a.emplace(a.begin() + 1, a[0]);
+  a.insert_many(a.end(), std::string("x"), std::string("y"));
+  EXPECT_EQ(a.size(), 5u);
+  EXPECT_EQ(a[0], "first");
+  EXPECT_EQ(a[1], "first");
+  EXPECT_EQ(a[2], "aa");
+  EXPECT_EQ(*(a.end() - 1), "y");
+}
+
+TEST_F(SmallVectorTests, insertManyAliasing) {
+  s21::SmallVector<std::string, 2> a{"first", "second"};
+  // Аргументы ссылаются на внутренний буфер, который опустеет при росте
+  a.insert_many_back(a[0], a[1]);
+  EXPECT_FALSE(a.is_inline());
+  a.insert_many(a.begin(), a[3], a[2], a[1], a[0]);
+  EXPECT_EQ(a.size(), 8u);
+  EXPECT_EQ(a[0], "second");
+  EXPECT_EQ(a[1], "first");
+  EXPECT_EQ(a[3], "first");
+  EXPECT_EQ(a[6], "first");
+  EXPECT_EQ(a[7], "second");
+}
+
+TEST_F(SmallVectorTests, copyAndMove) {
+  s21::SmallVector<std::string, 2> small{"a"};
+  s21::SmallVector<std::string, 2> big{"a", "b", "c"};
+
+  s21::SmallVector<std::string, 2> small_copy = small;
+  s21::SmallVector<std::string, 2> big_copy = big;
+  EXPECT_TRUE(small_copy.is_inline());
+  EXPECT_EQ(big_copy[2], "c");
+
+  const std::string* heap = big.data();
+  s21::SmallVector<std::string, 2> big_moved(std::move(big));
+  EXPECT_EQ(big_moved.data(), heap);
+  EXPECT_TRUE(big.empty());
+  EXPECT_TRUE(big.is_inline());
+
+  s21::SmallVector<std::string, 2> small_moved;
+  small_moved = std::move(small);
+  EXPECT_EQ(small_moved[0], "a");
+  EXPECT_TRUE(small.empty());
+
+  small_moved.swap(big_moved);
+  EXPECT_EQ(small_moved.size(), 3u);
+  EXPECT_EQ(big_moved.size(), 1u);
+  EXPECT_EQ(big_moved[0], "a");
+
+  big_copy = small_copy;
+  EXPECT_EQ(big_copy.size(), 1u);
+
+  static_assert(noexcept(small_moved.swap(big_moved)));
+}
+
+TEST_F(SmallVectorTests, moveOnly) {
+  s21::SmallVector<std::unique_ptr<int>, 2> a;
+  for (int i = 0; i < 5; ++i) a.push_back(std::make_unique<int>(i));
+  s21::SmallVector<std::unique_ptr<int>, 2> b(std::move(a));
+  EXPECT_EQ(*b[4], 4);
+  b.erase(b.begin() + 1);
+  EXPECT_EQ(*b[1], 2);
+}
+
+TEST_F(SmallVectorTests, stackDropIn) {
+  s21::Stack<int, s21::SmallVector<int, 16>> stack{1, 2, 3};
+  stack.push(4);
+  stack.insert_many_back(5, 6);
+  EXPECT_EQ(stack.top(), 6);
+  EXPECT_EQ(stack.size(), 6u);
+  stack.pop();
+  EXPECT_EQ(stack.top(), 5);
+
+  s21::Stack<int, s21::SmallVector<int, 16>> other;
+  other.swap(stack);
+  EXPECT_TRUE(stack.empty());
+  EXPECT_EQ(other.top(), 5);
+}
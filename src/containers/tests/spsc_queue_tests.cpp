@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "../queue/s21_spsc_queue.h"
+
+class SpscQueueTests : public ::testing::Test {
+ protected:
+  void SetUp() override {}
+  void TearDown() override {}
+};
+
+TEST_F(SpscQueueTests, boundedFifo) {
+  s21::SpscQueue<int> queue(3);
+  EXPECT_EQ(queue.capacity(), 4u);
+  EXPECT_TRUE(queue.empty());
+  EXPECT_EQ(queue.front(), nullptr);
+  for (int i = 0; i < 4; ++i) EXPECT_TRUE(queue.try_push(i));
+  EXPECT_FALSE(queue.try_push(4));
+  EXPECT_EQ(queue.size(), 4u);
+
+  int value = -1;
+  EXPECT_TRUE(queue.try_pop(value));
+  EXPECT_EQ(value, 0);
+  EXPECT_TRUE(queue.try_push(4));
+  for (int expected = 1; expected <= 4; ++expected) {
+    ASSERT_NE(queue.front(), nullptr);
+    EXPECT_EQ(*queue.front(), expected);
+    queue.pop();
+  }
+  EXPECT_FALSE(queue.try_pop(value));
+  EXPECT_THROW(s21::SpscQueue<int>(0), std::invalid_argument);
+}
+
+TEST_F(SpscQueueTests, ownsRemainingItems) {
+  s21::SpscQueue<std::unique_ptr<std::string>> queue(8);
+  queue.push(std::make_unique<std::string>("left in the queue"));
+  EXPECT_TRUE(queue.try_emplace(new std::string("emplaced")));
+  std::unique_ptr<std::string> out;
+  EXPECT_TRUE(queue.try_pop(out));
+  EXPECT_EQ(*out, "left in the queue");
+  EXPECT_EQ(queue.size(), 1u);
+}
+
+TEST_F(SpscQueueTests, twoThreadsKeepOrder) {
+  const int count = 200000;
+  s21::SpscQueue<int> queue(64);
+  std::thread producer([&] {
+    for (int i = 0; i < count; ++i) queue.push(i);
+  });
+  long long sum = 0;
+  int expected = 0;
+  bool ordered = true;
+  while (expected < count) {
+    int value;
+    if (!queue.try_pop(value)) {
+      std::this_thread::yield();
+      continue;
+    }
+    ordered = ordered && value == expected;
+    sum += value;
+    ++expected;
+  }
+  producer.join();
+  EXPECT_TRUE(ordered);
+  EXPECT_EQ(sum, 1LL * count * (count - 1) / 2);
+  EXPECT_TRUE(queue.empty());
+}
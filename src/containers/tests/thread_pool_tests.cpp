@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+
+#include "../deque/s21_thread_pool.h"
+
+class ThreadPoolTests : public ::testing::Test {
+ protected:
+  void SetUp() override {}
+  void TearDown() override {}
+};
+
+long long fib(s21::ThreadPool &pool, int n) {
+  if (n < 12) return n < 2 ? n : fib(pool, n - 1) + fib(pool, n - 2);
+  long long left = 0;
+  s21::TaskGroup group(pool);
+  group.run([&] { left = fib(pool, n - 1); });
+  long long right = fib(pool, n - 2);
+  group.wait();
+  return left + right;
+}
+
+TEST_F(ThreadPoolTests, DestructorRunsSubmittedTasks) {
+  std::atomic<int> counter{0};
+  {
+    s21::ThreadPool pool(3);
+    EXPECT_EQ(pool.size(), 3u);
+    for (int i = 0; i < 1000; ++i) {
+      pool.submit([&counter] { counter.fetch_add(1); });
+    }
+  }
+  EXPECT_EQ(counter.load(), 1000);
+}
+
+TEST_F(ThreadPoolTests, NestedTasksForkJoin) {
+  s21::ThreadPool pool(4);
+  EXPECT_EQ(fib(pool, 22), 17711);
+
+  std::atomic<int> leaves{0};
+  s21::TaskGroup group(pool);
+  for (int i = 0; i < 8; ++i) {
+    group.run([&pool, &leaves] {
+      s21::TaskGroup inner(pool);
+      for (int j = 0; j < 8; ++j) inner.run([&leaves] { ++leaves; });
+      inner.wait();
+    });
+  }
+  group.wait();
+  EXPECT_EQ(leaves.load(), 64);
+}
+
+TEST_F(ThreadPoolTests, WaitRethrowsTaskException) {
+  s21::ThreadPool pool(2);
+  s21::TaskGroup group(pool);
+  std::atomic<int> finished{0};
+  group.run([] { throw std::runtime_error("task failed"); });
+  for (int i = 0; i < 10; ++i) group.run([&finished] { ++finished; });
+  EXPECT_THROW(group.wait(), std::runtime_error);
+  EXPECT_EQ(finished.load(), 10);
+  group.wait();  // ошибка уже передана
+}
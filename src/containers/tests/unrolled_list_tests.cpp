@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../list/s21_unrolled_list.h"
+
+class UnrolledListTests : public ::testing::Test {
+ protected:
+  using Small = s21::UnrolledList<int, 4>;
+
+  template <typename ListType, typename Expected>
+  static void expect_same(const ListType &list, const Expected &expected) {
+    ASSERT_EQ(list.size(), expected.size());
+    auto it = list.cbegin();
+    for (const auto &value : expected) {
+      EXPECT_EQ(*it, value);
+      ++it;
+    }
+    EXPECT_TRUE(it == list.cend());
+  }
+};
+
+TEST_F(UnrolledListTests, pushPopAndIterate) {
+  Small a;
+  EXPECT_TRUE(a.empty());
+  EXPECT_TRUE(a.begin() == a.end());
+  for (int i = 0; i < 10; ++i) a.push_back(i);
+  for (int i = 1; i <= 3; ++i) a.push_front(-i);
+  expect_same(a, std::vector<int>{-3, -2, -1, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+  EXPECT_EQ(a.front(), -3);
+  EXPECT_EQ(a.back(), 9);
+
+  std::vector<int> backwards;
+  for (auto it = a.end(); it != a.begin();) backwards.push_back(*--it);
+  EXPECT_EQ(backwards.front(), 9);
+  EXPECT_EQ(backwards.back(), -3);
+
+  a.pop_front();
+  a.pop_back();
+  EXPECT_EQ(a.front(), -2);
+  EXPECT_EQ(a.back(), 8);
+  EXPECT_EQ(a.size(), 11u);
+  a.clear();
+  EXPECT_TRUE(a.empty());
+  a.pop_back();
+  EXPECT_TRUE(a.begin() == a.end());
+}
+
+TEST_F(UnrolledListTests, insertEraseMatchStdList) {
+  Small a;
+  std::list<int> expected;
+  std::mt19937 gen(7);
+  for (int step = 0; step < 2000; ++step) {
+    std::size_t at = expected.empty() ? 0 : gen() % (expected.size() + 1);
+    auto it = a.begin();
+    auto ref = expected.begin();
+    for (std::size_t i = 0; i < at; ++i, ++it, ++ref) {
+    }
+    if (expected.empty() || gen() % 3 != 0) {
+      auto inserted = a.insert(it, step);
+      expected.insert(ref, step);
+      EXPECT_EQ(*inserted, step);
+    } else {
+      if (ref == expected.end()) {
+        --it;
+        --ref;
+      }
+      auto next = a.erase(it);
+      auto ref_next = expected.erase(ref);
+      if (ref_next != expected.end()) {
+        EXPECT_EQ(*next, *ref_next);
+      }
+      EXPECT_EQ(next == a.end(), ref_next == expected.end());
+    }
+  }
+  expect_same(a, expected);
+}
+
+TEST_F(UnrolledListTests, insertAliasingElement) {
+  Small a{1, 2, 3, 4};
+  a.insert(a.cbegin(), a.back());
+  expect_same(a, std::vector<int>{4, 1, 2, 3, 4});
+}
+
+TEST_F(UnrolledListTests, sortUniqueReverse) {
+  Small a{5, 3, 3, 9, 1, 1, 1, 7, 3, 8, 8, 2};
+  a.sort();
+  expect_same(a, std::vector<int>{1, 1, 1, 2, 3, 3, 3, 5, 7, 8, 8, 9});
+  a.unique();
+  expect_same(a, std::vector<int>{1, 2, 3, 5, 7, 8, 9});
+  a.reverse();
+  expect_same(a, std::vector<int>{9, 8, 7, 5, 3, 2, 1});
+  a.sort([](int l, int r) { return l > r; });
+  expect_same(a, std::vector<int>{9, 8, 7, 5, 3, 2, 1});
+  a.push_back(0);
+  EXPECT_EQ(a.back(), 0);
+}
+
+TEST_F(UnrolledListTests, mergeSplice) {
+  Small a{1, 4, 6, 9};
+  Small b{2, 3, 5, 7, 8};
+  a.merge(b);
+  EXPECT_TRUE(b.empty());
+  expect_same(a, std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8, 9});
+
+  Small c{100, 200};
+  auto pos = a.cbegin();
+  ++pos;
+  ++pos;
+  a.splice(pos, c);
+  EXPECT_TRUE(c.empty());
+  expect_same(a, std::vector<int>{1, 2, 100, 200, 3, 4, 5, 6, 7, 8, 9});
+
+  c.splice(c.cend(), a, a.cbegin());
+  expect_same(c, std::vector<int>{1});
+  auto first = a.cbegin();
+  ++first;
+  auto last = first;
+  ++last;
+  ++last;
+  ++last;
+  c.splice(c.cbegin(), a, first, last);
+  expect_same(c, std::vector<int>{100, 200, 3, 1});
+  expect_same(a, std::vector<int>{2, 4, 5, 6, 7, 8, 9});
+
+  auto tail = a.cend();
+  --tail;
+  a.splice(a.cbegin(), a, tail);
+  expect_same(a, std::vector<int>{9, 2, 4, 5, 6, 7, 8});
+  auto from = a.cbegin();
+  ++from;
+  auto to = from;
+  ++to;
+  ++to;
+  ++to;
+  a.splice(a.cend(), a, from, to);
+  expect_same(a, std::vector<int>{9, 6, 7, 8, 2, 4, 5});
+}
+
+TEST_F(UnrolledListTests, copyMoveSwapStrings) {
+  s21::UnrolledList<std::string, 3> a{"one", "two", "three", "four"};
+  s21::UnrolledList<std::string, 3> b(a);
+  expect_same(b, a);
+  s21::UnrolledList<std::string, 3> c(std::move(a));
+  EXPECT_TRUE(a.empty());
+  expect_same(c, b);
+  a = c;
+  c.clear();
+  c.insert_many_back("x", "y");
+  a.swap(c);
+  expect_same(a, std::vector<std::string>{"x", "y"});
+  expect_same(c, b);
+  c.insert_many(++c.cbegin(), "a", "b");
+  expect_same(c, std::vector<std::string>{"one", "a", "b", "two", "three",
+                                          "four"});
+}
@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 
 #include <iostream>
+#include <memory>
+#include <string>
 
 #include "../vector/s21_vector.h"
 
@@ -114,7 +116,9 @@ TEST_F(VectorTests, constData) {
 TEST_F(VectorTests, reserve) {
   s21::Vector<int> a{1, 2};
   a.reserve(10);
-  EXPECT_EQ(a[3], 0);
+  EXPECT_EQ(a.capacity(), 10u);
+  EXPECT_EQ(a.size(), 2u);
+  EXPECT_EQ(a[1], 2);
 }
 
 TEST_F(VectorTests, begin) {
@@ -230,4 +234,183 @@ TEST_F(VectorTests, throw1) {
   EXPECT_THROW(a.insert(it1, 10), std::out_of_range);
   EXPECT_THROW(a.insert_many(it1, 10), std::out_of_range);
   EXPECT_THROW(a.erase(it1), std::out_of_range);
-}
\ No newline at end of file
+}
+
+namespace {
+struct NoDefault {
+  explicit NoDefault(int v) : value(v) { ++alive; }
+  NoDefault(const NoDefault& other) : value(other.value) { ++alive; }
+  NoDefault& operator=(const NoDefault& other) = default;
+  ~NoDefault() { --alive; }
+  int value;
+  static int alive;
+};
+int NoDefault::alive = 0;
+
+struct Relocatable {
+  explicit Relocatable(int v) : value(new int(v)) {}
+  Relocatable(const Relocatable& other) : value(new int(*other.value)) {}
+  Relocatable& operator=(const Relocatable& other) {
+    *value = *other.value;
+    return *this;
+  }
+  ~Relocatable() {
+    delete value;
+    ++destroyed;
+  }
+  int* value;
+  static int destroyed;
+};
+int Relocatable::destroyed = 0;
+}  // namespace
+
+template <>
+struct s21::is_trivially_relocatable<Relocatable> : std::true_type {};
+
+TEST_F(VectorTests, trivialRelocation) {
+  s21::Vector<int> a;
+  for (int i = 0; i < 100000; ++i) a.push_back(i);
+  a.shrink_to_fit();
+  EXPECT_EQ(a.capacity(), a.size());
+  a.reserve(a.size() * 4);
+  EXPECT_EQ(a[99999], 99999);
+  a.clear();
+  a.shrink_to_fit();
+  EXPECT_EQ(a.capacity(), 0u);
+  EXPECT_EQ(a.data(), nullptr);
+
+  {
+    s21::Vector<Relocatable> b;
+    for (int i = 0; i < 33; ++i) b.emplace_back(i);
+    // Перенос при реаллокации не вызывает деструкторы
+    Relocatable::destroyed = 0;
+    b.reserve(1000);
+    b.pop_back();
+    b.shrink_to_fit();
+    EXPECT_EQ(Relocatable::destroyed, 1);
+    EXPECT_EQ(*b[0].value, 0);
+    EXPECT_EQ(*b[31].value, 31);
+  }
+  EXPECT_EQ(Relocatable::destroyed, 33);
+}
+
+TEST_F(VectorTests, rawStorage) {
+  {
+    s21::Vector<NoDefault> a;
+    for (int i = 0; i < 10; ++i) a.push_back(NoDefault(i));
+    EXPECT_EQ(NoDefault::alive, 10);
+    a.reserve(100);
+    EXPECT_EQ(NoDefault::alive, 10);
+    a.insert(a.begin() + 3, NoDefault(42));
+    a.insert_many(a.begin(), NoDefault(-1), NoDefault(-2));
+    EXPECT_EQ(NoDefault::alive, 13);
+    EXPECT_EQ(a[0].value, -1);
+    EXPECT_EQ(a[1].value, -2);
+    EXPECT_EQ(a[5].value, 42);
+    EXPECT_EQ(a[12].value, 9);
+    a.erase(a.begin());
+    a.pop_back();
+    EXPECT_EQ(NoDefault::alive, 11);
+    a.shrink_to_fit();
+    s21::Vector<NoDefault> b = a;
+    EXPECT_EQ(NoDefault::alive, 22);
+    b.clear();
+    EXPECT_EQ(NoDefault::alive, 11);
+  }
+  EXPECT_EQ(NoDefault::alive, 0);
+}
+
+TEST_F(VectorTests, moveOnlyGrowth) {
+  s21::Vector<std::unique_ptr<int>> a;
+  for (int i = 0; i < 20; ++i) {
+    a.push_back(std::make_unique<int>(i));
+  }
+  a.emplace(a.begin() + 5, new int(100));
+  a.insert(a.begin(), std::make_unique<int>(-1));
+  a.erase(a.begin() + 1);
+  EXPECT_EQ(a.size(), 21u);
+  EXPECT_EQ(*a[0], -1);
+  EXPECT_EQ(*a[5], 100);
+  EXPECT_EQ(*a[6], 5);
+  EXPECT_EQ(*a.back(), 19);
+}
+
+TEST_F(VectorTests, emplaceBack) {
+  s21::Vector<std::string> a;
+  std::string &ref = a.emplace_back(3, 'x');
+  EXPECT_EQ(ref, "xxx");
+  std::string moved = "moved";
+  a.push_back(std::move(moved));
+  EXPECT_EQ(a[1], "moved");
+  a.insert_many_back(std::string("a"), std::string("b"));
+  // Аргумент ссылается на элемент, который переедет при росте
+  a.push_back(a[0]);
+  a.emplace(a.begin() + 1, a[3]);
+  EXPECT_EQ(a.size(), 6u);
+  EXPECT_EQ(a[1], "b");
+  EXPECT_EQ(a[2], "moved");
+  EXPECT_EQ(a[5], "xxx");
+}
+
+TEST_F(VectorTests, insertManyAliasing) {
+  s21::Vector<std::string> a{"first", "second"};
+  ASSERT_EQ(a.size(), a.capacity());
+  // Аргументы ссылаются на элементы, которые переедут при росте
+  a.insert_many_back(a[0], a[1]);
+  a.shrink_to_fit();
+  a.insert_many(a.begin() + 1, a[3], a[2]);
+  EXPECT_EQ(a.size(), 6u);
+  EXPECT_EQ(a[0], "first");
+  EXPECT_EQ(a[1], "second");
+  EXPECT_EQ(a[2], "first");
+  EXPECT_EQ(a[3], "second");
+  EXPECT_EQ(a[4], "first");
+  EXPECT_EQ(a[5], "second");
+
+  s21::Vector<int> b{1, 2, 3};
+  b.insert_many(b.begin(), b[2], b[1]);
+  EXPECT_EQ(b.size(), 5u);
+  EXPECT_EQ(b[0], 3);
+  EXPECT_EQ(b[1], 2);
+  EXPECT_EQ(b[4], 3);
+}
+
+TEST_F(VectorTests, growthPolicies) {
+  s21::Vector<int> doubling;
+  s21::Vector<int, s21::HalfGrowth> half;
+  s21::Vector<int, s21::FixedGrowth<10>> fixed;
+  s21::Vector<int, s21::SizeClassGrowth> size_class;
+  for (int i = 0; i < 100; ++i) {
+    doubling.push_back(i);
+    half.push_back(i);
+    fixed.push_back(i);
+    size_class.push_back(i);
+  }
+  EXPECT_EQ(doubling.capacity(), 128u);
+  EXPECT_EQ(half.capacity(), 140u);
+  EXPECT_EQ(fixed.capacity(), 100u);
+  // 96 * 1.5 = 144 элемента = 576 байт, класс 640 байт
+  EXPECT_EQ(size_class.capacity(), 160u);
+  EXPECT_EQ(s21::SizeClassGrowth::round_to_size_class(385), 448u);
+  EXPECT_EQ(s21::SizeClassGrowth::round_to_size_class(4097), 5120u);
+  EXPECT_EQ(half[99], 99);
+  EXPECT_EQ(fixed[99], 99);
+  EXPECT_EQ(size_class[99], 99);
+
+  doubling.insert_many_back(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+                            16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28,
+                            29);
+  EXPECT_EQ(doubling.capacity(), 256u);
+}
+
+TEST_F(VectorTests, reserveExact) {
+  s21::Vector<int> a{1, 2, 3};
+  a.reserve_exact(50);
+  EXPECT_EQ(a.capacity(), 50u);
+  a.reserve_exact(10);
+  EXPECT_EQ(a.capacity(), 50u);
+  for (int i = 3; i < 50; ++i) a.push_back(i);
+  EXPECT_EQ(a.capacity(), 50u);
+  EXPECT_EQ(a[49], 49);
+  EXPECT_THROW(a.reserve_exact(a.max_size() + 1), std::length_error);
+}
@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "../deque/s21_work_stealing_deque.h"
+
+class WorkStealingDequeTests : public ::testing::Test {
+ protected:
+  void SetUp() override {}
+  void TearDown() override {}
+};
+
+TEST_F(WorkStealingDequeTests, OwnerLifoThiefFifo) {
+  s21::WorkStealingDeque<int> deque(4);
+  EXPECT_TRUE(deque.empty());
+  for (int i = 0; i < 5; ++i) deque.push(i);
+  EXPECT_EQ(deque.size(), 5u);
+
+  int value = -1;
+  EXPECT_TRUE(deque.pop(value));
+  EXPECT_EQ(value, 4);
+  EXPECT_TRUE(deque.steal(value));
+  EXPECT_EQ(value, 0);
+  EXPECT_TRUE(deque.steal(value));
+  EXPECT_EQ(value, 1);
+  EXPECT_TRUE(deque.pop(value));
+  EXPECT_EQ(value, 3);
+  EXPECT_TRUE(deque.pop(value));
+  EXPECT_EQ(value, 2);
+  EXPECT_FALSE(deque.pop(value));
+  EXPECT_FALSE(deque.steal(value));
+  EXPECT_TRUE(deque.empty());
+  EXPECT_THROW(s21::WorkStealingDeque<int>(0), std::invalid_argument);
+}
+
+TEST_F(WorkStealingDequeTests, GrowsAndKeepsOrder) {
+  s21::WorkStealingDeque<int> deque(2);
+  for (int round = 0; round < 3; ++round) {
+    for (int i = 0; i < 100; ++i) deque.push(i);
+    int value = -1;
+    EXPECT_TRUE(deque.steal(value));
+    EXPECT_EQ(value, 0);
+    for (int i = 99; i > 0; --i) {
+      EXPECT_TRUE(deque.pop(value));
+      EXPECT_EQ(value, i);
+    }
+    EXPECT_FALSE(deque.pop(value));
+  }
+  EXPECT_EQ(deque.capacity(), 128u);
+}
+
+TEST_F(WorkStealingDequeTests, ThievesAndOwnerTakeEachItemOnce) {
+  constexpr int kItems = 20000;
+  constexpr int kThieves = 3;
+  s21::WorkStealingDeque<int> deque(8);
+  std::vector<std::atomic<int>> taken(kItems);
+  for (auto &count : taken) count.store(0);
+  std::atomic<bool> done{false};
+
+  std::vector<std::thread> thieves;
+  for (int t = 0; t < kThieves; ++t) {
+    thieves.emplace_back([&] {
+      int value;
+      while (!done.load() || !deque.empty()) {
+        if (deque.steal(value)) {
+          taken[value].fetch_add(1);
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+
+  // Владелец чередует push и pop, чтобы спорить с ворами за последний
+  // элемент и проходить через рост буфера
+  int value;
+  for (int i = 0; i < kItems; ++i) {
+    deque.push(i);
+    if (i % 3 == 0 && deque.pop(value)) taken[value].fetch_add(1);
+  }
+  while (deque.pop(value)) taken[value].fetch_add(1);
+  done.store(true);
+  for (auto &thief : thieves) thief.join();
+
+  for (const auto &count : taken) EXPECT_EQ(count.load(), 1);
+}
@@ -0,0 +1,219 @@
+#pragma once
+#include "s21_vector_base.h"
+
+namespace s21 {
+// Вектор с буфером на N элементов внутри объекта. Пока размер не превышает
+// N, память в куче не выделяется; интерфейс совпадает с s21::Vector.
+template <typename T, std::size_t N, typename GrowthPolicy = DoubleGrowth>
+class SmallVector
+    : public VectorBase<SmallVector<T, N, GrowthPolicy>, T, GrowthPolicy> {
+  static_assert(N > 0, "SmallVector needs at least one inline slot");
+
+  using Base = VectorBase<SmallVector<T, N, GrowthPolicy>, T, GrowthPolicy>;
+  friend Base;
+
+ public:  // members
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using iterator = T*;
+  using const_iterator = const T*;
+  using size_type = std::size_t;
+
+ private:  // attributes
+  using Base::capacity_;
+  using Base::data_;
+  using Base::size_;
+  alignas(value_type) unsigned char buffer_[N * sizeof(value_type)];
+
+ public:  // constructors
+  SmallVector();
+  explicit SmallVector(size_type n);
+  SmallVector(std::initializer_list<value_type> const& items);
+  SmallVector(const SmallVector& v);
+  SmallVector(SmallVector&& v) noexcept(
+      std::is_nothrow_move_constructible_v<T>);
+  ~SmallVector();
+
+  SmallVector& operator=(SmallVector&& v) noexcept(
+      std::is_nothrow_move_constructible_v<T>);
+  SmallVector& operator=(const SmallVector& v);
+
+ public:  // capacity
+  void shrink_to_fit();
+  bool is_inline() const noexcept;
+
+ public:  // vector modifiers
+  void swap(SmallVector& other) noexcept(
+      std::is_nothrow_move_constructible_v<T>);
+
+ private:  // storage
+  using Base::relocate;
+  value_type* inline_data() noexcept;
+  static value_type* allocate(size_type n);
+  static void deallocate(value_type* p) noexcept;
+  void deallocate_storage() noexcept;
+  void reallocate(size_type new_cap);
+  void steal(SmallVector& v);
+  void release() noexcept;
+};
+
+template <typename T, std::size_t N, typename GrowthPolicy>
+SmallVector<T, N, GrowthPolicy>::SmallVector()
+    : Base(0, N, reinterpret_cast<value_type*>(buffer_)) {}
+
+template <typename T, std::size_t N, typename GrowthPolicy>
+SmallVector<T, N, GrowthPolicy>::SmallVector(size_type n) : SmallVector() {
+  this->reserve_exact(n);
+  std::uninitialized_value_construct_n(data_, n);
+  size_ = n;
+}
+
+template <typename T, std::size_t N, typename GrowthPolicy>
+SmallVector<T, N, GrowthPolicy>::SmallVector(
+    std::initializer_list<value_type> const& items)
+    : SmallVector() {
+  this->reserve_exact(items.size());
+  std::uninitialized_copy(items.begin(), items.end(), data_);
+  size_ = items.size();
+}
+
+template <typename T, std::size_t N, typename GrowthPolicy>
+SmallVector<T, N, GrowthPolicy>::SmallVector(const SmallVector& v)
+    : SmallVector() {
+  this->reserve_exact(v.size_);
+  std::uninitialized_copy(v.data_, v.data_ + v.size_, data_);
+  size_ = v.size_;
+}
+
+template <typename T, std::size_t N, typename GrowthPolicy>
+SmallVector<T, N, GrowthPolicy>::SmallVector(SmallVector&& v) noexcept(
+    std::is_nothrow_move_constructible_v<T>)
+    : SmallVector() {
+  steal(v);
+}
+
+template <typename T, std::size_t N, typename GrowthPolicy>
+SmallVector<T, N, GrowthPolicy>::~SmallVector() {
+  release();
+}
+
+template <typename T, std::size_t N, typename GrowthPolicy>
+SmallVector<T, N, GrowthPolicy>& SmallVector<T, N, GrowthPolicy>::operator=(
+    SmallVector&& v) noexcept(std::is_nothrow_move_constructible_v<T>) {
+  if (this != &v) {
+    release();
+    steal(v);
+  }
+  return *this;
+}
+
+template <typename T, std::size_t N, typename GrowthPolicy>
+SmallVector<T, N, GrowthPolicy>& SmallVector<T, N, GrowthPolicy>::operator=(
+    const SmallVector& v) {
+  if (this != &v) {
+    SmallVector copy(v);
+    *this = std::move(copy);
+  }
+  return *this;
+}
+
+template <typename T, std::size_t N, typename GrowthPolicy>
+void SmallVector<T, N, GrowthPolicy>::shrink_to_fit() {
+  if (!is_inline() && size_ < capacity_) {
+    reallocate(size_);
+  }
+}
+
+template <typename T, std::size_t N, typename GrowthPolicy>
+bool SmallVector<T, N, GrowthPolicy>::is_inline() const noexcept {
+  return data_ == reinterpret_cast<const value_type*>(buffer_);
+}
+
+template <typename T, std::size_t N, typename GrowthPolicy>
+void SmallVector<T, N, GrowthPolicy>::swap(SmallVector& other) noexcept(
+    std::is_nothrow_move_constructible_v<T>) {
+  if (!is_inline() && !other.is_inline()) {
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(data_, other.data_);
+  } else {
+    // Внутренний буфер не передать указателем: элементы переносятся
+    // через временный вектор
+    SmallVector tmp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(tmp);
+  }
+}
+
+template <typename T, std::size_t N, typename GrowthPolicy>
+typename SmallVector<T, N, GrowthPolicy>::value_type*
+SmallVector<T, N, GrowthPolicy>::inline_data() noexcept {
+  return reinterpret_cast<value_type*>(buffer_);
+}
+
+template <typename T, std::size_t N, typename GrowthPolicy>
+typename SmallVector<T, N, GrowthPolicy>::value_type*
+SmallVector<T, N, GrowthPolicy>::allocate(size_type n) {
+  return static_cast<value_type*>(::operator new(n * sizeof(value_type)));
+}
+
+template <typename T, std::size_t N, typename GrowthPolicy>
+void SmallVector<T, N, GrowthPolicy>::deallocate(value_type* p) noexcept {
+  ::operator delete(p);
+}
+
+template <typename T, std::size_t N, typename GrowthPolicy>
+void SmallVector<T, N, GrowthPolicy>::deallocate_storage() noexcept {
+  if (!is_inline()) deallocate(data_);
+}
+
+template <typename T, std::size_t N, typename GrowthPolicy>
+void SmallVector<T, N, GrowthPolicy>::reallocate(size_type new_cap) {
+  // Пока элементы помещаются во внутренний буфер, возвращаемся в него
+  bool to_inline = new_cap <= N;
+  if (to_inline && is_inline()) return;
+  value_type* new_data = to_inline ? inline_data() : allocate(new_cap);
+  try {
+    relocate(data_, data_ + size_, new_data);
+  } catch (...) {
+    if (!to_inline) deallocate(new_data);
+    throw;
+  }
+  if constexpr (!is_trivially_relocatable_v<T>) {
+    std::destroy(data_, data_ + size_);
+  }
+  deallocate_storage();
+  data_ = new_data;
+  capacity_ = to_inline ? N : new_cap;
+}
+
+template <typename T, std::size_t N, typename GrowthPolicy>
+void SmallVector<T, N, GrowthPolicy>::steal(SmallVector& v) {
+  // Куча переходит владельцу целиком, внутренний буфер переносится
+  // поэлементно
+  if (v.is_inline()) {
+    relocate(v.data_, v.data_ + v.size_, data_);
+    if constexpr (!is_trivially_relocatable_v<T>) {
+      std::destroy(v.data_, v.data_ + v.size_);
+    }
+    size_ = v.size_;
+  } else {
+    data_ = v.data_;
+    size_ = v.size_;
+    capacity_ = v.capacity_;
+    v.data_ = v.inline_data();
+    v.capacity_ = N;
+  }
+  v.size_ = 0;
+}
+
+template <typename T, std::size_t N, typename GrowthPolicy>
+void SmallVector<T, N, GrowthPolicy>::release() noexcept {
+  std::destroy(data_, data_ + size_);
+  deallocate_storage();
+  data_ = inline_data();
+  size_ = 0;
+  capacity_ = N;
+}
+}  // namespace s21
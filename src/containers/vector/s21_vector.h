@@ -1,12 +1,14 @@
 #pragma once
-#include <algorithm>
-#include <cstddef>
-#include <stdexcept>
-#include <utility>
+#include <cstdlib>
+
+#include "s21_vector_base.h"
 
 namespace s21 {
-template <typename T>
-class Vector {
+template <typename T, typename GrowthPolicy = DoubleGrowth>
+class Vector : public VectorBase<Vector<T, GrowthPolicy>, T, GrowthPolicy> {
+  using Base = VectorBase<Vector<T, GrowthPolicy>, T, GrowthPolicy>;
+  friend Base;
+
  public:  // members
   using value_type = T;
   using reference = T&;
@@ -16,9 +18,14 @@ class Vector {
   using size_type = std::size_t;
 
  private:  // attributes
-  size_type size_;
-  size_type capacity_;
-  value_type* data_;
+  using Base::capacity_;
+  using Base::data_;
+  using Base::size_;
+
+  // Буфер переносимых типов живёт в malloc, чтобы расти через realloc
+  static constexpr bool kReallocatable =
+      is_trivially_relocatable_v<T> &&
+      alignof(T) <= alignof(std::max_align_t);
 
  public:  // constructors
   Vector();
@@ -31,87 +38,68 @@ class Vector {
   Vector& operator=(Vector&& v) noexcept;
   Vector& operator=(const Vector& v);
 
- public:  // accessors
-  reference at(size_type pos);
-  const_reference at(size_type pos) const;
-  reference operator[](size_type pos);
-  const_reference operator[](size_type pos) const;
-  reference front();
-  const_reference front() const;
-  reference back();
-  const_reference back() const;
-  T* data() noexcept;
-  const T* data() const noexcept;
-
- public:  // iterators
-  iterator begin() noexcept;
-  const_iterator begin() const noexcept;
-  const_iterator cbegin() const noexcept;
-  iterator end() noexcept;
-  const_iterator end() const noexcept;
-  const_iterator cend() const noexcept;
-
  public:  // capacity
-  bool empty() const noexcept;
-  size_type size() const noexcept;
-  size_type max_size() const noexcept;
-  void reserve(size_type new_cap);
-  size_type capacity() const noexcept;
   void shrink_to_fit();
 
  public:  // vector modifiers
-  void clear() noexcept;
-  iterator insert(const_iterator pos, const_reference value);
-
-  template <typename... Args>
-  iterator insert_many(const_iterator pos, Args&&... args);
-  template <typename... Args>
-  void insert_many_back(Args&&... args);
-  iterator erase(const_iterator pos);
-  void push_back(const_reference value);
-  void pop_back();
   void swap(Vector& other) noexcept;
-};
 
-template <typename T>
-Vector<T>::Vector() : size_(0), capacity_(0), data_(nullptr) {}
+ private:  // raw storage
+  using Base::relocate;
+  static value_type* allocate(size_type n);
+  static void deallocate(value_type* p) noexcept;
+  void deallocate_storage() noexcept;
+  template <typename InputIt>
+  static value_type* allocate_copy(size_type n, InputIt first, InputIt last);
+  void reallocate(size_type new_cap);
+};
 
-template <typename T>
-Vector<T>::Vector(size_type n) : size_(n), capacity_(n), data_(new T[n]) {}
+template <typename T, typename GrowthPolicy>
+Vector<T, GrowthPolicy>::Vector() : Base(0, 0, nullptr) {}
 
-template <typename T>
-Vector<T>::Vector(std::initializer_list<value_type> const& items)
-    : size_(items.size()), capacity_(items.size()), data_(new T[items.size()]) {
-  std::copy(items.begin(), items.end(), data_);
+template <typename T, typename GrowthPolicy>
+Vector<T, GrowthPolicy>::Vector(size_type n) : Base(n, n, allocate(n)) {
+  try {
+    std::uninitialized_value_construct_n(data_, n);
+  } catch (...) {
+    deallocate(data_);
+    throw;
+  }
 }
 
-template <typename T>
-Vector<T>::Vector(const Vector& v)
-    : size_(v.size_), capacity_(v.capacity_), data_(new T[v.size_]) {
-  std::copy(v.data_, v.data_ + v.size_, data_);
-}
+template <typename T, typename GrowthPolicy>
+Vector<T, GrowthPolicy>::Vector(std::initializer_list<value_type> const& items)
+    : Base(items.size(), items.size(),
+           allocate_copy(items.size(), items.begin(), items.end())) {}
+
+template <typename T, typename GrowthPolicy>
+Vector<T, GrowthPolicy>::Vector(const Vector& v)
+    : Base(v.size_, v.size_,
+           allocate_copy(v.size_, v.data_, v.data_ + v.size_)) {}
 
-template <typename T>
-Vector<T>::Vector(Vector&& v) noexcept
-    : size_(v.size_), capacity_(v.capacity_), data_(v.data_) {
+template <typename T, typename GrowthPolicy>
+Vector<T, GrowthPolicy>::Vector(Vector&& v) noexcept
+    : Base(v.size_, v.capacity_, v.data_) {
   v.size_ = 0;
   v.capacity_ = 0;
   v.data_ = nullptr;
 }
 
-template <typename T>
-Vector<T>::~Vector() {
-  delete[] data_;
+template <typename T, typename GrowthPolicy>
+Vector<T, GrowthPolicy>::~Vector() {
+  std::destroy(data_, data_ + size_);
+  deallocate(data_);
 }
 
-template <typename T>
-Vector<T>& Vector<T>::operator=(Vector&& v) noexcept {
+template <typename T, typename GrowthPolicy>
+Vector<T, GrowthPolicy>& Vector<T, GrowthPolicy>::operator=(
+    Vector&& v) noexcept {
   if (this != &v) {
     this->~Vector();
 
     size_ = v.size_;
     capacity_ = v.capacity_;
-    data_ = std::move(v.data_);
+    data_ = v.data_;
 
     v.size_ = 0;
     v.capacity_ = 0;
@@ -120,239 +108,104 @@ Vector<T>& Vector<T>::operator=(Vector&& v) noexcept {
   return *this;
 }
 
-template <typename T>
-Vector<T>& Vector<T>::operator=(const Vector& v) {
+template <typename T, typename GrowthPolicy>
+Vector<T, GrowthPolicy>& Vector<T, GrowthPolicy>::operator=(const Vector& v) {
   if (this != &v) {
-    delete[] data_;
+    value_type* new_data = allocate_copy(v.size_, v.data_, v.data_ + v.size_);
+    this->~Vector();
     size_ = v.size_;
-    capacity_ = v.capacity_;
-    data_ = new T[v.size_];
-    if (!data_) {
-      throw std::bad_alloc();
-    }
-    std::copy(v.data_, v.data_ + v.size_, data_);
+    capacity_ = v.size_;
+    data_ = new_data;
   }
   return *this;
 }
 
-template <typename T>
-typename Vector<T>::reference Vector<T>::at(size_type pos) {
-  if (pos >= size_) {
-    throw std::out_of_range("Index out of range");
-  }
-  return data_[pos];
-}
-
-template <typename T>
-typename Vector<T>::const_reference Vector<T>::at(size_type pos) const {
-  if (pos >= size_) {
-    throw std::out_of_range("Index out of range");
-  }
-  return data_[pos];
-}
-
-template <typename T>
-typename Vector<T>::reference Vector<T>::operator[](size_type pos) {
-  return data_[pos];
-}
-
-template <typename T>
-typename Vector<T>::const_reference Vector<T>::operator[](size_type pos) const {
-  return data_[pos];
-}
-
-template <typename T>
-typename Vector<T>::reference Vector<T>::front() {
-  return data_[0];
-}
-
-template <typename T>
-typename Vector<T>::const_reference Vector<T>::front() const {
-  return data_[0];
-}
-
-template <typename T>
-typename Vector<T>::reference Vector<T>::back() {
-  return data_[size_ - 1];
-}
-
-template <typename T>
-typename Vector<T>::const_reference Vector<T>::back() const {
-  return data_[size_ - 1];
-}
-
-template <typename T>
-typename Vector<T>::iterator Vector<T>::data() noexcept {
-  return data_;
-}
-
-template <typename T>
-typename Vector<T>::const_iterator Vector<T>::data() const noexcept {
-  return data_;
-}
-
-template <typename T>
-typename Vector<T>::iterator Vector<T>::begin() noexcept {
-  return data_;
-}
-
-template <typename T>
-typename Vector<T>::const_iterator Vector<T>::begin() const noexcept {
-  return data_;
-}
-
-template <typename T>
-typename Vector<T>::const_iterator Vector<T>::cbegin() const noexcept {
-  return data_;
-}
-
-template <typename T>
-typename Vector<T>::iterator Vector<T>::end() noexcept {
-  return data_ + size_;
-}
-
-template <typename T>
-typename Vector<T>::const_iterator Vector<T>::end() const noexcept {
-  return data_ + size_;
-}
-
-template <typename T>
-typename Vector<T>::const_iterator Vector<T>::cend() const noexcept {
-  return data_ + size_;
-}
-
-template <typename T>
-bool Vector<T>::empty() const noexcept {
-  return size_ == 0;
-}
-
-template <typename T>
-typename Vector<T>::size_type Vector<T>::size() const noexcept {
-  return size_;
-}
-
-template <typename T>
-typename Vector<T>::size_type Vector<T>::max_size() const noexcept {
-  return std::numeric_limits<std::size_t>::max() / sizeof(value_type);
-}
-
-template <typename T>
-void Vector<T>::reserve(size_type new_cap) {
-  if (new_cap <= capacity_) {
-    throw std::length_error("Error length of new capacity");
-  }
-  if (new_cap > this->max_size()) {
-    throw std::length_error("Error length");
-  }
-  T* new_data = new value_type[new_cap];
-  std::copy(data_, data_ + size_, new_data);
-  delete[] data_;
-  data_ = new_data;
-  capacity_ = new_cap;
-}
-
-template <typename T>
-typename Vector<T>::size_type Vector<T>::capacity() const noexcept {
-  return capacity_;
-}
-
-template <typename T>
-void Vector<T>::shrink_to_fit() {
+template <typename T, typename GrowthPolicy>
+void Vector<T, GrowthPolicy>::shrink_to_fit() {
   if (size_ < capacity_) {
-    iterator new_data = new value_type[size_];
-    std::copy(data_, data_ + size_, new_data);
-    delete[] data_;
-    data_ = new_data;
-    capacity_ = size_;
+    reallocate(size_);
   }
 }
 
-template <typename T>
-void Vector<T>::clear() noexcept {
-  size_ = 0;
+template <typename T, typename GrowthPolicy>
+void Vector<T, GrowthPolicy>::swap(Vector& other) noexcept {
+  std::swap(size_, other.size_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(data_, other.data_);
 }
 
-template <typename T>
-typename Vector<T>::iterator Vector<T>::insert(const_iterator pos,
-                                               const_reference value) {
-  size_type index = pos - data_;
-
-  if (index > size_) {
-    throw std::out_of_range("Index is out of range");
-  }
-
-  if (size_ + 1 > capacity_) {
-    reserve(capacity_ ? capacity_ * 2 : 1);
+template <typename T, typename GrowthPolicy>
+typename Vector<T, GrowthPolicy>::value_type* Vector<T, GrowthPolicy>::allocate(
+    size_type n) {
+  if (n == 0) return nullptr;
+  if constexpr (kReallocatable) {
+    void* p = std::malloc(n * sizeof(value_type));
+    if (!p) throw std::bad_alloc();
+    return static_cast<value_type*>(p);
+  } else {
+    return static_cast<value_type*>(::operator new(n * sizeof(value_type)));
   }
-
-  std::copy_backward(data_ + index, data_ + size_, data_ + size_ + 1);
-  data_[index] = value;
-  ++size_;
-  return data_ + index;
 }
 
-template <typename T>
-template <typename... Args>
-typename Vector<T>::iterator Vector<T>::insert_many(const_iterator pos,
-                                                    Args&&... args) {
-  int count = sizeof...(args);
-  size_t index = pos - data_;
-
-  if (index > size_) {
-    throw std::out_of_range("Index is out of range");
-  }
-
-  if (size_ + count > capacity_) {
-    reserve(capacity_ ? (capacity_ + count) * 2 : 1);
+template <typename T, typename GrowthPolicy>
+void Vector<T, GrowthPolicy>::deallocate(value_type* p) noexcept {
+  if constexpr (kReallocatable) {
+    std::free(p);
+  } else {
+    ::operator delete(p);
   }
-
-  std::copy_backward(data_ + index, data_ + size_, data_ + size_ + 1);
-
-  ((data_[index++] = std::forward<T>(args)), ...);
-  size_ += count;
-  return data_ + index - count;
 }
-template <typename T>
-template <typename... Args>
-void Vector<T>::insert_many_back(Args&&... args) {
-  insert_many(cend(), args...);
+
+template <typename T, typename GrowthPolicy>
+void Vector<T, GrowthPolicy>::deallocate_storage() noexcept {
+  deallocate(data_);
 }
 
-template <typename T>
-typename Vector<T>::iterator Vector<T>::erase(const_iterator pos) {
-  size_type index = pos - data_;
-  if (index >= size_) {
-    throw std::out_of_range("Index out of range");
+template <typename T, typename GrowthPolicy>
+template <typename InputIt>
+typename Vector<T, GrowthPolicy>::value_type*
+Vector<T, GrowthPolicy>::allocate_copy(size_type n, InputIt first,
+                                       InputIt last) {
+  value_type* new_data = allocate(n);
+  try {
+    std::uninitialized_copy(first, last, new_data);
+  } catch (...) {
+    deallocate(new_data);
+    throw;
   }
-  for (size_type i = index; i < size_ - 1; ++i) {
-    data_[i] = data_[i + 1];
+  return new_data;
+}
+
+template <typename T, typename GrowthPolicy>
+void Vector<T, GrowthPolicy>::reallocate(size_type new_cap) {
+  if constexpr (kReallocatable) {
+    // realloc растит блок на месте, а большие блоки переносит через mremap,
+    // не трогая элементы
+    if (new_cap == 0) {
+      deallocate(data_);
+      data_ = nullptr;
+    } else {
+      void* p = std::realloc(static_cast<void*>(data_),
+                             new_cap * sizeof(value_type));
+      if (!p) throw std::bad_alloc();
+      data_ = static_cast<value_type*>(p);
+    }
+    capacity_ = new_cap;
+    return;
   }
-  --size_;
-  if (index == size_) {
-    return end();
-  } else {
-    return data_ + index;
+  value_type* new_data = allocate(new_cap);
+  try {
+    relocate(data_, data_ + size_, new_data);
+  } catch (...) {
+    deallocate(new_data);
+    throw;
   }
-}
-
-template <typename T>
-void Vector<T>::push_back(const_reference value) {
-  if (size_ >= capacity_) {
-    reserve(capacity_ == 0 ? 1 : capacity_ * 2);
+  // После побайтового переноса старые объекты уже "переехали"
+  if constexpr (!is_trivially_relocatable_v<T>) {
+    std::destroy(data_, data_ + size_);
   }
-  ++size_;
-  this->back() = value;
-}
-
-template <typename T>
-void Vector<T>::pop_back() {
-  --size_;
-}
-
-template <typename T>
-void Vector<T>::swap(Vector& other) noexcept {
-  std::swap(size_, other.size_);
-  std::swap(capacity_, other.capacity_);
-  std::swap(data_, other.data_);
+  deallocate(data_);
+  data_ = new_data;
+  capacity_ = new_cap;
 }
-}  // namespace s21
\ No newline at end of file
+}  // namespace s21
@@ -0,0 +1,449 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_vector_growth.h"
+
+namespace s21 {
+// Тип можно переносить побайтовым копированием без вызова конструктора
+// перемещения и деструктора исходника. Пользовательские типы могут
+// специализировать трейт, если владеют ресурсами, но не хранят
+// указателей на самих себя.
+template <typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+template <typename T>
+inline constexpr bool is_trivially_relocatable_v =
+    is_trivially_relocatable<T>::value;
+
+// Общая часть Vector и SmallVector: доступ к элементам, вставка, удаление и
+// рост. Наследник владеет буфером и предоставляет:
+//   static T* allocate(size_type n)      — новый буфер в куче;
+//   static void deallocate(T* p)         — освобождение такого буфера;
+//   void deallocate_storage() noexcept   — освобождение текущего data_;
+//   void reallocate(size_type new_cap)   — перенос элементов в буфер new_cap.
+template <typename Derived, typename T, typename GrowthPolicy>
+class VectorBase {
+ public:  // members
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using iterator = T*;
+  using const_iterator = const T*;
+  using size_type = std::size_t;
+
+ protected:  // attributes
+  size_type size_;
+  size_type capacity_;
+  value_type* data_;
+
+  VectorBase(size_type size, size_type capacity, value_type* data) noexcept
+      : size_(size), capacity_(capacity), data_(data) {}
+  VectorBase(const VectorBase&) = default;
+  VectorBase& operator=(const VectorBase&) = default;
+  ~VectorBase() = default;
+
+ public:  // accessors
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  reference front();
+  const_reference front() const;
+  reference back();
+  const_reference back() const;
+  T* data() noexcept;
+  const T* data() const noexcept;
+
+ public:  // iterators
+  iterator begin() noexcept;
+  const_iterator begin() const noexcept;
+  const_iterator cbegin() const noexcept;
+  iterator end() noexcept;
+  const_iterator end() const noexcept;
+  const_iterator cend() const noexcept;
+
+ public:  // capacity
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type max_size() const noexcept;
+  void reserve(size_type new_cap);
+  void reserve_exact(size_type new_cap);
+  size_type capacity() const noexcept;
+
+ public:  // vector modifiers
+  void clear() noexcept;
+  iterator insert(const_iterator pos, const_reference value);
+  iterator insert(const_iterator pos, value_type&& value);
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args&&... args);
+
+  template <typename... Args>
+  iterator insert_many(const_iterator pos, Args&&... args);
+  template <typename... Args>
+  void insert_many_back(Args&&... args);
+  iterator erase(const_iterator pos);
+  void push_back(const_reference value);
+  void push_back(value_type&& value);
+  template <typename... Args>
+  reference emplace_back(Args&&... args);
+  void pop_back();
+
+ protected:  // raw storage
+  static void relocate(value_type* first, value_type* last, value_type* dest);
+  size_type grown_capacity(size_type count) const;
+  void grow_for(size_type count);
+
+ private:
+  Derived& derived() noexcept { return static_cast<Derived&>(*this); }
+};
+
+template <typename Derived, typename T, typename GrowthPolicy>
+typename VectorBase<Derived, T, GrowthPolicy>::reference
+VectorBase<Derived, T, GrowthPolicy>::at(size_type pos) {
+  if (pos >= size_) {
+    throw std::out_of_range("Index out of range");
+  }
+  return data_[pos];
+}
+
+template <typename Derived, typename T, typename GrowthPolicy>
+typename VectorBase<Derived, T, GrowthPolicy>::const_reference
+VectorBase<Derived, T, GrowthPolicy>::at(size_type pos) const {
+  if (pos >= size_) {
+    throw std::out_of_range("Index out of range");
+  }
+  return data_[pos];
+}
+
+template <typename Derived, typename T, typename GrowthPolicy>
+typename VectorBase<Derived, T, GrowthPolicy>::reference
+VectorBase<Derived, T, GrowthPolicy>::operator[](size_type pos) {
+  return data_[pos];
+}
+
+template <typename Derived, typename T, typename GrowthPolicy>
+typename VectorBase<Derived, T, GrowthPolicy>::const_reference
+VectorBase<Derived, T, GrowthPolicy>::operator[](size_type pos) const {
+  return data_[pos];
+}
+
+template <typename Derived, typename T, typename GrowthPolicy>
+typename VectorBase<Derived, T, GrowthPolicy>::reference
+VectorBase<Derived, T, GrowthPolicy>::front() {
+  return data_[0];
+}
+
+template <typename Derived, typename T, typename GrowthPolicy>
+typename VectorBase<Derived, T, GrowthPolicy>::const_reference
+VectorBase<Derived, T, GrowthPolicy>::front() const {
+  return data_[0];
+}
+
+template <typename Derived, typename T, typename GrowthPolicy>
+typename VectorBase<Derived, T, GrowthPolicy>::reference
+VectorBase<Derived, T, GrowthPolicy>::back() {
+  return data_[size_ - 1];
+}
+
+template <typename Derived, typename T, typename GrowthPolicy>
+typename VectorBase<Derived, T, GrowthPolicy>::const_reference
+VectorBase<Derived, T, GrowthPolicy>::back() const {
+  return data_[size_ - 1];
+}
+
+template <typename Derived, typename T, typename GrowthPolicy>
+T* VectorBase<Derived, T, GrowthPolicy>::data() noexcept {
+  return data_;
+}
+
+template <typename Derived, typename T, typename GrowthPolicy>
+const T* VectorBase<Derived, T, GrowthPolicy>::data() const noexcept {
+  return data_;
+}
+
+template <typename Derived, typename T, typename GrowthPolicy>
+typename VectorBase<Derived, T, GrowthPolicy>::iterator
+VectorBase<Derived, T, GrowthPolicy>::begin() noexcept {
+  return data_;
+}
+
+template <typename Derived, typename T, typename GrowthPolicy>
+typename VectorBase<Derived, T, GrowthPolicy>::const_iterator
+VectorBase<Derived, T, GrowthPolicy>::begin() const noexcept {
+  return data_;
+}
+
+template <typename Derived, typename T, typename GrowthPolicy>
+typename VectorBase<Derived, T, GrowthPolicy>::const_iterator
+VectorBase<Derived, T, GrowthPolicy>::cbegin() const noexcept {
+  return data_;
+}
+
+template <typename Derived, typename T, typename GrowthPolicy>
+typename VectorBase<Derived, T, GrowthPolicy>::iterator
+VectorBase<Derived, T, GrowthPolicy>::end() noexcept {
+  return data_ + size_;
+}
+
+template <typename Derived, typename T, typename GrowthPolicy>
+typename VectorBase<Derived, T, GrowthPolicy>::const_iterator
+VectorBase<Derived, T, GrowthPolicy>::end() const noexcept {
+  return data_ + size_;
+}
+
+template <typename Derived, typename T, typename GrowthPolicy>
+typename VectorBase<Derived, T, GrowthPolicy>::const_iterator
+VectorBase<Derived, T, GrowthPolicy>::cend() const noexcept {
+  return data_ + size_;
+}
+
+template <typename Derived, typename T, typename GrowthPolicy>
+bool VectorBase<Derived, T, GrowthPolicy>::empty() const noexcept {
+  return size_ == 0;
+}
+
+template <typename Derived, typename T, typename GrowthPolicy>
+typename VectorBase<Derived, T, GrowthPolicy>::size_type
+VectorBase<Derived, T, GrowthPolicy>::size() const noexcept {
+  return size_;
+}
+
+template <typename Derived, typename T, typename GrowthPolicy>
+typename VectorBase<Derived, T, GrowthPolicy>::size_type
+VectorBase<Derived, T, GrowthPolicy>::max_size() const noexcept {
+  return std::numeric_limits<std::size_t>::max() / sizeof(value_type);
+}
+
+template <typename Derived, typename T, typename GrowthPolicy>
+void VectorBase<Derived, T, GrowthPolicy>::reserve(size_type new_cap) {
+  if (new_cap <= capacity_) {
+    throw std::length_error("Error length of new capacity");
+  }
+  if (new_cap > this->max_size()) {
+    throw std::length_error("Error length");
+  }
+  derived().reallocate(new_cap);
+}
+
+template <typename Derived, typename T, typename GrowthPolicy>
+void VectorBase<Derived, T, GrowthPolicy>::reserve_exact(size_type new_cap) {
+  if (new_cap > this->max_size()) {
+    throw std::length_error("Error length");
+  }
+  if (new_cap > capacity_) {
+    derived().reallocate(new_cap);
+  }
+}
+
+template <typename Derived, typename T, typename GrowthPolicy>
+typename VectorBase<Derived, T, GrowthPolicy>::size_type
+VectorBase<Derived, T, GrowthPolicy>::capacity() const noexcept {
+  return capacity_;
+}
+
+template <typename Derived, typename T, typename GrowthPolicy>
+void VectorBase<Derived, T, GrowthPolicy>::clear() noexcept {
+  std::destroy(data_, data_ + size_);
+  size_ = 0;
+}
+
+template <typename Derived, typename T, typename GrowthPolicy>
+typename VectorBase<Derived, T, GrowthPolicy>::iterator
+VectorBase<Derived, T, GrowthPolicy>::insert(const_iterator pos,
+                                             const_reference value) {
+  return emplace(pos, value);
+}
+
+template <typename Derived, typename T, typename GrowthPolicy>
+typename VectorBase<Derived, T, GrowthPolicy>::iterator
+VectorBase<Derived, T, GrowthPolicy>::insert(const_iterator pos,
+                                             value_type&& value) {
+  return emplace(pos, std::move(value));
+}
+
+template <typename Derived, typename T, typename GrowthPolicy>
+template <typename... Args>
+typename VectorBase<Derived, T, GrowthPolicy>::iterator
+VectorBase<Derived, T, GrowthPolicy>::emplace(const_iterator pos,
+                                              Args&&... args) {
+  size_type index = pos - data_;
+
+  if (index > size_) {
+    throw std::out_of_range("Index is out of range");
+  }
+
+  if (index == size_) {
+    emplace_back(std::forward<Args>(args)...);
+  } else {
+    // Аргументы могут ссылаться на элементы самого вектора, поэтому
+    // значение собирается до сдвига хвоста и возможной реаллокации
+    value_type value(std::forward<Args>(args)...);
+    grow_for(1);
+    // Хвост сдвигается на одну позицию: последний элемент конструируется
+    // в неинициализированной ячейке, остальные перемещаются
+    new (data_ + size_) value_type(std::move(data_[size_ - 1]));
+    ++size_;
+    std::move_backward(data_ + index, data_ + size_ - 2, data_ + size_ - 1);
+    data_[index] = std::move(value);
+  }
+  return data_ + index;
+}
+
+template <typename Derived, typename T, typename GrowthPolicy>
+template <typename... Args>
+typename VectorBase<Derived, T, GrowthPolicy>::iterator
+VectorBase<Derived, T, GrowthPolicy>::insert_many(const_iterator pos,
+                                                  Args&&... args) {
+  size_type count = sizeof...(args);
+  size_type index = pos - data_;
+
+  if (index > size_) {
+    throw std::out_of_range("Index is out of range");
+  }
+
+  if (size_ + count > capacity_) {
+    // Аргументы могут ссылаться на старый буфер, поэтому новые элементы
+    // собираются в новом буфере до переноса старых
+    size_type new_cap = grown_capacity(count);
+    value_type* new_data = Derived::allocate(new_cap);
+    value_type* hole = new_data + index;
+    size_type built = 0;
+    try {
+      ((new (hole + built) value_type(std::forward<Args>(args)), ++built),
+       ...);
+      relocate(data_, data_ + index, new_data);
+      try {
+        relocate(data_ + index, data_ + size_, hole + count);
+      } catch (...) {
+        std::destroy(new_data, hole);
+        throw;
+      }
+    } catch (...) {
+      std::destroy(hole, hole + built);
+      Derived::deallocate(new_data);
+      throw;
+    }
+    if constexpr (!is_trivially_relocatable_v<T>) {
+      std::destroy(data_, data_ + size_);
+    }
+    derived().deallocate_storage();
+    data_ = new_data;
+    size_ += count;
+    capacity_ = new_cap;
+    return data_ + index;
+  }
+
+  // Новые элементы конструируются в конце и поворотом встают на место
+  size_type old_size = size_;
+  try {
+    ((new (data_ + size_) value_type(std::forward<Args>(args)), ++size_), ...);
+  } catch (...) {
+    std::destroy(data_ + old_size, data_ + size_);
+    size_ = old_size;
+    throw;
+  }
+  std::rotate(data_ + index, data_ + old_size, data_ + size_);
+  return data_ + index;
+}
+
+template <typename Derived, typename T, typename GrowthPolicy>
+template <typename... Args>
+void VectorBase<Derived, T, GrowthPolicy>::insert_many_back(Args&&... args) {
+  insert_many(cend(), std::forward<Args>(args)...);
+}
+
+template <typename Derived, typename T, typename GrowthPolicy>
+typename VectorBase<Derived, T, GrowthPolicy>::iterator
+VectorBase<Derived, T, GrowthPolicy>::erase(const_iterator pos) {
+  size_type index = pos - data_;
+  if (index >= size_) {
+    throw std::out_of_range("Index out of range");
+  }
+  std::move(data_ + index + 1, data_ + size_, data_ + index);
+  pop_back();
+  return data_ + index;
+}
+
+template <typename Derived, typename T, typename GrowthPolicy>
+void VectorBase<Derived, T, GrowthPolicy>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename Derived, typename T, typename GrowthPolicy>
+void VectorBase<Derived, T, GrowthPolicy>::push_back(value_type&& value) {
+  emplace_back(std::move(value));
+}
+
+template <typename Derived, typename T, typename GrowthPolicy>
+template <typename... Args>
+typename VectorBase<Derived, T, GrowthPolicy>::reference
+VectorBase<Derived, T, GrowthPolicy>::emplace_back(Args&&... args) {
+  if (size_ >= capacity_) {
+    // Аргументы могут ссылаться на старый буфер: собираем значение до роста
+    value_type value(std::forward<Args>(args)...);
+    grow_for(1);
+    new (data_ + size_) value_type(std::move(value));
+  } else {
+    new (data_ + size_) value_type(std::forward<Args>(args)...);
+  }
+  ++size_;
+  return data_[size_ - 1];
+}
+
+template <typename Derived, typename T, typename GrowthPolicy>
+void VectorBase<Derived, T, GrowthPolicy>::pop_back() {
+  --size_;
+  std::destroy_at(data_ + size_);
+}
+
+template <typename Derived, typename T, typename GrowthPolicy>
+void VectorBase<Derived, T, GrowthPolicy>::relocate(value_type* first,
+                                                    value_type* last,
+                                                    value_type* dest) {
+  if constexpr (is_trivially_relocatable_v<T>) {
+    if (first != last) {
+      std::memcpy(static_cast<void*>(dest), static_cast<const void*>(first),
+                  (last - first) * sizeof(value_type));
+    }
+    return;
+  }
+  // Перемещаем, если перемещение не бросает (или копирование недоступно),
+  // иначе копируем, чтобы исключение не испортило исходный буфер
+  value_type* current = dest;
+  try {
+    for (; first != last; ++first, ++current) {
+      new (current) value_type(std::move_if_noexcept(*first));
+    }
+  } catch (...) {
+    std::destroy(dest, current);
+    throw;
+  }
+}
+
+template <typename Derived, typename T, typename GrowthPolicy>
+typename VectorBase<Derived, T, GrowthPolicy>::size_type
+VectorBase<Derived, T, GrowthPolicy>::grown_capacity(size_type count) const {
+  if (count > max_size() - size_) {
+    throw std::length_error("Error length");
+  }
+  size_type new_cap = GrowthPolicy::next_capacity(capacity_, size_ + count,
+                                                  sizeof(value_type));
+  return std::min(new_cap, max_size());
+}
+
+template <typename Derived, typename T, typename GrowthPolicy>
+void VectorBase<Derived, T, GrowthPolicy>::grow_for(size_type count) {
+  if (size_ + count > capacity_) {
+    derived().reallocate(grown_capacity(count));
+  }
+}
+}  // namespace s21
@@ -0,0 +1,57 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+
+namespace s21 {
+// Политики роста ёмкости Vector. next_capacity возвращает новую ёмкость
+// не меньше required; elem_size нужен политикам, работающим в байтах.
+
+// Удвоение: минимум реаллокаций, до 50% запаса.
+struct DoubleGrowth {
+  static std::size_t next_capacity(std::size_t current, std::size_t required,
+                                   std::size_t /*elem_size*/) {
+    return std::max(required, current ? current * 2 : 1);
+  }
+};
+
+// Рост в 1.5 раза: меньше запаса, освобождённые блоки можно переиспользовать.
+struct HalfGrowth {
+  static std::size_t next_capacity(std::size_t current, std::size_t required,
+                                   std::size_t /*elem_size*/) {
+    return std::max(required, current ? current + (current + 1) / 2 : 1);
+  }
+};
+
+// Рост в 1.5 раза с округлением размера блока вверх до размерного класса
+// аллокатора (четыре класса на каждую степень двойки, как в jemalloc и
+// tcmalloc). Хвост, который аллокатор всё равно выделил бы, становится
+// ёмкостью.
+struct SizeClassGrowth {
+  static std::size_t next_capacity(std::size_t current, std::size_t required,
+                                   std::size_t elem_size) {
+    std::size_t target =
+        std::max(required, current ? current + (current + 1) / 2 : 1);
+    return round_to_size_class(target * elem_size) / elem_size;
+  }
+
+  static std::size_t round_to_size_class(std::size_t bytes) {
+    const std::size_t min_class = 16;
+    if (bytes <= min_class) return min_class;
+    std::size_t power = min_class;
+    while (power * 2 < bytes) power *= 2;
+    std::size_t step = power / 4;
+    return (bytes + step - 1) / step * step;
+  }
+};
+
+// Рост на фиксированное число элементов: запас не больше Increment.
+template <std::size_t Increment>
+struct FixedGrowth {
+  static_assert(Increment > 0, "Increment must be positive");
+
+  static std::size_t next_capacity(std::size_t current, std::size_t required,
+                                   std::size_t /*elem_size*/) {
+    return std::max(required, current + Increment);
+  }
+};
+}  // namespace s21